@@ -0,0 +1,38 @@
+/*
+ * asset.c
+ * loading tiled background assets into video memory with DMA
+ */
+
+#include "gba.h"
+#include "dma.h"
+#include "decompress.h"
+#include "asset.h"
+
+void asset_load(const struct TileAsset* asset, int char_block_index, int screen_block_index) {
+    asset_load_image(asset, char_block_index);
+
+    if (asset->tile_map) {
+        asset_load_map(asset->tile_map, asset->tile_map_width, asset->tile_map_height, screen_block_index);
+    }
+}
+
+void asset_load_image(const struct TileAsset* asset, int char_block_index) {
+    if (asset->palette) {
+        dma_copy(bg_palette, asset->palette, PALETTE_SIZE * 2);
+    }
+
+    if (asset->compressed) {
+        decompress_vram(char_block(char_block_index), asset->data);
+    } else {
+        /* one byte per pixel, or half a byte for 4bpp */
+        int bytes = asset->width * asset->height;
+        if (asset->bpp == 4) {
+            bytes /= 2;
+        }
+        dma_copy(char_block(char_block_index), asset->data, bytes);
+    }
+}
+
+void asset_load_map(const unsigned short* tile_map, int width, int height, int screen_block_index) {
+    dma_copy(screen_block(screen_block_index), tile_map, width * height * 2);
+}
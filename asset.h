@@ -0,0 +1,49 @@
+/*
+ * asset.h
+ * loading tiled background assets into video memory with DMA
+ */
+
+#ifndef ASSET_H
+#define ASSET_H
+
+/* a 256 or 16 color tile image with its palette and, optionally, a tile map
+ * the fields match what png2gba and the GBA Tile Editor generate */
+struct TileAsset {
+    /* the 8bpp tile image and its size in pixels, the image may be
+     * compressed for the BIOS (see decompress.h) */
+    const void* data;
+    unsigned short width, height;
+
+    /* the 256 color palette, or 0 to keep the one already loaded */
+    const unsigned short* palette;
+
+    /* the tile map and its size in tiles, or 0 for no map */
+    const unsigned short* tile_map;
+    unsigned short tile_map_width, tile_map_height;
+
+    /* non zero when the image is LZ77 or run length compressed */
+    unsigned char compressed;
+
+    /* bits per pixel, 4 for 16 color tiles using palette banks, or 0 or 8
+     * for 256 color tiles */
+    unsigned char bpp;
+};
+
+/* the color mode bit (bit 7) of a background control register for an asset */
+static inline unsigned short asset_color_mode(const struct TileAsset* asset) {
+    return (asset->bpp == 4) ? 0 : (1 << 7);
+}
+
+/* load the palette, the image into a char block (0-3) and the map into a
+ * screen block (0-31), every part is one 32-bit DMA transfer, or one BIOS
+ * decompression for a compressed image */
+void asset_load(const struct TileAsset* asset, int char_block_index, int screen_block_index);
+
+/* load only the palette and the image into a char block (0-3), for when
+ * the map is put into video memory some other way, such as streaming */
+void asset_load_image(const struct TileAsset* asset, int char_block_index);
+
+/* load only a tile map into a screen block (0-31) */
+void asset_load_map(const unsigned short* tile_map, int width, int height, int screen_block_index);
+
+#endif
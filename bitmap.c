@@ -0,0 +1,21 @@
+/*
+ * bitmap.c
+ * fast whole screen fills for the bitmap modes
+ *
+ * both fills are a single 32-bit DMA transfer from a fixed source, which
+ * writes a mode 4 page in well under a frame, compared with a read-modify-write
+ * of every pixel through put_pixel
+ */
+
+#include "gba.h"
+#include "dma.h"
+#include "bitmap.h"
+
+void mode3_clear(unsigned short color) {
+    dma_fill(screen, color | ((unsigned int) color << 16), WIDTH * HEIGHT * 2);
+}
+
+void mode4_clear(volatile unsigned short* page, unsigned char color) {
+    unsigned int pair = color | (color << 8);
+    dma_fill(page, pair | (pair << 16), WIDTH * HEIGHT);
+}
@@ -0,0 +1,16 @@
+/*
+ * bitmap.h
+ * fast whole screen fills for the bitmap modes
+ */
+
+#ifndef BITMAP_H
+#define BITMAP_H
+
+/* fill the mode 3 screen, 240x160 16-bit pixels, with one color */
+void mode3_clear(unsigned short color);
+
+/* fill one mode 4 page, 240x160 8-bit pixels, with one palette index
+ * page is front_buffer or back_buffer */
+void mode4_clear(volatile unsigned short* page, unsigned char color);
+
+#endif
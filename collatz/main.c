@@ -8,81 +8,18 @@
 /* include the image we are using */
 #include "background.h"
 
-/* the width and height of the screen */
-#define WIDTH 240
-#define HEIGHT 160
-
-/* the three tile modes */
-#define MODE0 0x00
-#define MODE1 0x01
-#define MODE2 0x02
-
-/* enable bits for the four tile layers */
-#define BG0_ENABLE 0x100
-#define BG1_ENABLE 0x200
-#define BG2_ENABLE 0x400
-#define BG3_ENABLE 0x800
-
-/* the control registers for the four tile layers */
-volatile unsigned short* bg0_control = (volatile unsigned short*) 0x4000008;
-volatile unsigned short* bg1_control = (volatile unsigned short*) 0x400000a;
-volatile unsigned short* bg2_control = (volatile unsigned short*) 0x400000c;
-volatile unsigned short* bg3_control = (volatile unsigned short*) 0x400000e;
-
-/* palette is always 256 colors */
-#define PALETTE_SIZE 256
-
-/* flag for turning on DMA */
-#define DMA_ENABLE 0x80000000
-
-/* flags for the sizes to transfer, 16 or 32 bits */
-#define DMA_16 0x00000000
-#define DMA_32 0x04000000
-
-/* pointer to the DMA source location */
-volatile unsigned int* dma_source = (volatile unsigned int*) 0x40000D4;
-
-/* pointer to the DMA destination location */
-volatile unsigned int* dma_destination = (volatile unsigned int*) 0x40000D8;
-
-/* pointer to the DMA count/control */
-volatile unsigned int* dma_count = (volatile unsigned int*) 0x40000DC;
-
-/* copy data using DMA */
-void memcpy16_dma(unsigned short* dest, unsigned short* source, int amount) {
-    *dma_source = (unsigned int) source;
-    *dma_destination = (unsigned int) dest;
-    *dma_count = amount | DMA_16 | DMA_ENABLE;
-}
-
-
-/* the display control pointer points to the gba graphics register */
-volatile unsigned long* display_control = (volatile unsigned long*) 0x4000000;
-
-/* the address of the color palette */
-volatile unsigned short* bg_palette = (volatile unsigned short*) 0x5000000;
-
-/* return a pointer to one of the 4 character blocks (0-3) */
-volatile unsigned short* char_block(unsigned long block) {
-    /* they are each 16K big */
-    return (volatile unsigned short*) (0x6000000 + (block * 0x4000));
-}
-
-/* return a pointer to one of the 32 screen blocks (0-31) */
-volatile unsigned short* screen_block(unsigned long block) {
-    /* they are each 2K big */
-    return (volatile unsigned short*) (0x6000000 + (block * 0x800));
-}
+/* include the shared hardware definitions and DMA */
+#include "../gba.h"
+#include "../dma.h"
 
 
 /* function to setup background 0 for this program */
 void setup_background() {
     /* load the palette from the image into palette memory*/
-    memcpy16_dma((unsigned short*) bg_palette, (unsigned short*) background_palette, PALETTE_SIZE);
+    dma_copy(bg_palette, background_palette, PALETTE_SIZE * 2);
 
     /* load the image into char block 0 */
-    memcpy16_dma((unsigned short*) char_block(0), (unsigned short*) background_data,
-            (background_width * background_height) / 2);
+    dma_copy(char_block(0), background_data, background_width * background_height);
 
     /* bg0 is just all black so the pink does not show through! */
     *bg0_control = 3 |    /* priority, 0 is highest, 3 is lowest */
@@ -163,30 +100,3 @@ int main( ) {
     }
 }
 
-
-/* the game boy advance uses "interrupts" to handle certain situations
- * for now we will ignore these */
-void interrupt_ignore( ) {
-    /* do nothing */
-}
-
-
-/* this table specifies which interrupts we handle which way
- * for now, we ignore all of them */
-typedef void (*intrp)( );
-const intrp IntrTable[13] = {
-    interrupt_ignore,   /* V Blank interrupt */
-    interrupt_ignore,   /* H Blank interrupt */
-    interrupt_ignore,   /* V Counter interrupt */
-    interrupt_ignore,   /* Timer 0 interrupt */
-    interrupt_ignore,   /* Timer 1 interrupt */
-    interrupt_ignore,   /* Timer 2 interrupt */
-    interrupt_ignore,   /* Timer 3 interrupt */
-    interrupt_ignore,   /* Serial communication interrupt */
-    interrupt_ignore,   /* DMA 0 interrupt */
-    interrupt_ignore,   /* DMA 1 interrupt */
-    interrupt_ignore,   /* DMA 2 interrupt */
-    interrupt_ignore,   /* DMA 3 interrupt */
-    interrupt_ignore,   /* Key interrupt */
-};
-
@@ -0,0 +1,37 @@
+/*
+ * decompress.c
+ * unpacking LZ77 and run length compressed data with the BIOS
+ */
+
+#include "decompress.h"
+
+/* the BIOS calls take the source in r0 and the destination in r1, they run
+ * from ROM at a few cycles per byte so a whole char block fits in a map
+ * transition */
+void decompress_lz77_vram(volatile void* dest, const void* source) {
+    register const void* src asm("r0") = source;
+    register volatile void* dst asm("r1") = dest;
+#if defined(__thumb__)
+    asm volatile("swi 0x12" : "+r"(src), "+r"(dst) :: "r2", "r3", "memory");
+#else
+    asm volatile("swi 0x120000" : "+r"(src), "+r"(dst) :: "r2", "r3", "memory");
+#endif
+}
+
+void decompress_rle_vram(volatile void* dest, const void* source) {
+    register const void* src asm("r0") = source;
+    register volatile void* dst asm("r1") = dest;
+#if defined(__thumb__)
+    asm volatile("swi 0x15" : "+r"(src), "+r"(dst) :: "r2", "r3", "memory");
+#else
+    asm volatile("swi 0x150000" : "+r"(src), "+r"(dst) :: "r2", "r3", "memory");
+#endif
+}
+
+void decompress_vram(volatile void* dest, const void* source) {
+    if (decompress_type(source) == DECOMPRESS_RLE) {
+        decompress_rle_vram(dest, source);
+    } else {
+        decompress_lz77_vram(dest, source);
+    }
+}
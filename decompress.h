@@ -0,0 +1,36 @@
+/*
+ * decompress.h
+ * unpacking LZ77 and run length compressed data with the BIOS
+ *
+ * the data is in the format the BIOS decompression calls take, a 32-bit
+ * header of (size << 8) | type followed by the compressed stream, and must
+ * be 4 byte aligned - tools/gbacomp.c makes it from a png2gba header
+ */
+
+#ifndef DECOMPRESS_H
+#define DECOMPRESS_H
+
+/* the type in the low byte of the header */
+#define DECOMPRESS_LZ77 0x10
+#define DECOMPRESS_RLE 0x30
+
+/* the size of the data once decompressed, in bytes */
+static inline unsigned int decompress_size(const void* source) {
+    return *(const unsigned int*) source >> 8;
+}
+
+/* the type of compression used */
+static inline unsigned int decompress_type(const void* source) {
+    return *(const unsigned int*) source & 0xf0;
+}
+
+/* unpack LZ77 data into video memory, which only takes 16-bit writes */
+void decompress_lz77_vram(volatile void* dest, const void* source);
+
+/* unpack run length data into video memory */
+void decompress_rle_vram(volatile void* dest, const void* source);
+
+/* unpack data of either type into video memory, going by its header */
+void decompress_vram(volatile void* dest, const void* source);
+
+#endif
@@ -0,0 +1,84 @@
+/*
+ * dma.c
+ * the four gba DMA channels
+ */
+
+#include "dma.h"
+
+/* the most units a single DMA 3 transfer can move, a count of 0 means this */
+#define DMA3_MAX_COUNT 0x10000
+
+/* the word a fill reads over and over with a fixed source */
+static volatile unsigned int fill_word;
+
+void dma_transfer(int channel, volatile void* dest, const volatile void* source,
+        unsigned int count, unsigned int flags) {
+    volatile unsigned int* registers = dma_channel(channel);
+
+    /* a channel must not be reprogrammed while it is still going, a
+     * repeating transfer never finishes on its own so it is stopped */
+    if (registers[2] & DMA_REPEAT) {
+        dma_stop(channel);
+    } else {
+        dma_wait(channel);
+    }
+
+    registers[0] = (unsigned int) source;
+    registers[1] = (unsigned int) dest;
+    registers[2] = (count & 0xffff) | flags | DMA_ENABLE;
+}
+
+/* run count units on the copy channel, splitting anything over the
+ * largest count, and wait for the last piece to finish */
+static void dma_run(volatile void* dest, const volatile void* source, unsigned int count,
+        unsigned int flags) {
+    unsigned int unit = (flags & DMA_32) ? 4 : 2;
+
+    while (count > 0) {
+        unsigned int amount = count > DMA3_MAX_COUNT ? DMA3_MAX_COUNT : count;
+        dma_transfer(DMA_COPY_CHANNEL, dest, source, amount, flags);
+
+        dest = (volatile char*) dest + amount * unit;
+        if (!(flags & DMA_SRC_FIXED)) {
+            source = (const volatile char*) source + amount * unit;
+        }
+        count -= amount;
+    }
+    dma_wait(DMA_COPY_CHANNEL);
+}
+
+void dma_copy(volatile void* dest, const volatile void* source, unsigned int bytes) {
+    /* 32-bit transfers need both addresses word aligned, they move twice
+     * as much per bus transaction, so use them for all but an odd halfword */
+    if ((((unsigned int) dest | (unsigned int) source) & 3) == 0) {
+        dma_run(dest, source, bytes >> 2, DMA_32);
+        if (bytes & 2) {
+            dma_run((volatile char*) dest + (bytes & ~3),
+                    (const volatile char*) source + (bytes & ~3), 1, DMA_16);
+        }
+    } else {
+        dma_run(dest, source, bytes >> 1, DMA_16);
+    }
+}
+
+void dma_fill(volatile void* dest, unsigned int value, unsigned int bytes) {
+    fill_word = value;
+
+    if (((unsigned int) dest & 3) == 0) {
+        dma_run(dest, &fill_word, bytes >> 2, DMA_32 | DMA_SRC_FIXED);
+        if (bytes & 2) {
+            dma_run((volatile char*) dest + (bytes & ~3), &fill_word, 1, DMA_16 | DMA_SRC_FIXED);
+        }
+    } else {
+        dma_run(dest, &fill_word, bytes >> 1, DMA_16 | DMA_SRC_FIXED);
+    }
+}
+
+void dma_set_callback(int channel, intrp callback) {
+    interrupt_set_handler(INTERRUPT_DMA0 + channel, callback);
+    if (callback) {
+        interrupt_enable(INTERRUPT_DMA0 + channel);
+    } else {
+        interrupt_disable(INTERRUPT_DMA0 + channel);
+    }
+}
@@ -0,0 +1,78 @@
+/*
+ * dma.h
+ * the four gba DMA channels
+ *
+ * dma_copy and dma_fill use DMA 3, pick 32-bit transfers whenever the
+ * addresses and size allow it, and do not return until the copy is done
+ * dma_transfer starts a raw transfer on any channel with any timing
+ */
+
+#ifndef DMA_H
+#define DMA_H
+
+#include "gba.h"
+#include "interrupt.h"
+
+/* how the destination address changes after each unit */
+#define DMA_DEST_INC 0x00000000
+#define DMA_DEST_DEC 0x00200000
+#define DMA_DEST_FIXED 0x00400000
+#define DMA_DEST_RELOAD 0x00600000
+
+/* how the source address changes after each unit */
+#define DMA_SRC_INC 0x00000000
+#define DMA_SRC_DEC 0x00800000
+#define DMA_SRC_FIXED 0x01000000
+
+/* restart the transfer at every trigger instead of only once */
+#define DMA_REPEAT 0x02000000
+
+/* when the transfer starts */
+#define DMA_AT_NOW 0x00000000
+#define DMA_AT_VBLANK 0x10000000
+#define DMA_AT_HBLANK 0x20000000
+#define DMA_AT_SPECIAL 0x30000000
+
+/* raise the channel's interrupt when the transfer finishes */
+#define DMA_IRQ 0x40000000
+
+/* the channel used for general copies, it is the only one which can write
+ * to game pak memory and it has the largest count */
+#define DMA_COPY_CHANNEL 3
+
+/* return whether a channel still has a transfer pending or running */
+static inline int dma_busy(int channel) {
+    return (dma_channel(channel)[2] & DMA_ENABLE) != 0;
+}
+
+/* wait for a transfer on a channel to finish */
+static inline void dma_wait(int channel) {
+    while (dma_busy(channel)) { }
+}
+
+/* stop a channel, for ending repeating transfers */
+static inline void dma_stop(int channel) {
+    dma_channel(channel)[2] = 0;
+}
+
+/* start a transfer of count units on a channel, DMA 3 takes up to 0x10000
+ * units and the others up to 0x4000, flags holds the size,
+ * address modes, timing and DMA_IRQ, the enable bit is added here
+ * a transfer still going on the channel is waited for, or stopped if it
+ * was started with DMA_REPEAT
+ * this returns right away, use dma_wait or dma_set_callback to find out
+ * when the transfer is done */
+void dma_transfer(int channel, volatile void* dest, const volatile void* source,
+        unsigned int count, unsigned int flags);
+
+/* copy bytes from source to dest, bytes must be a multiple of 2 */
+void dma_copy(volatile void* dest, const volatile void* source, unsigned int bytes);
+
+/* set bytes of dest to a repeated 32-bit value, bytes must be a multiple of 2 */
+void dma_fill(volatile void* dest, unsigned int value, unsigned int bytes);
+
+/* call a function from the DMA interrupt of a channel whenever a transfer
+ * started with DMA_IRQ finishes, 0 removes it */
+void dma_set_callback(int channel, intrp callback);
+
+#endif
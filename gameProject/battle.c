@@ -0,0 +1,532 @@
+/*
+Turn based battles, drawn on bg2 over the map.
+*/
+
+#include "../gba.h"
+#include "../dma.h"
+#include "../input.h"
+#include "../timer.h"
+#include "battle.h"
+
+/* The battle layer uses char block 1 and screen block 18, clear of the map's tiles and screen blocks. */
+#define BATTLE_CHAR_BLOCK 1
+#define BATTLE_SCREEN_BLOCK 18
+
+/*
+Palette entries of the battle colors, at the top of the palette where the maps have no colors.
+*/
+#define COLOR_BACKDROP 240
+#define COLOR_PANEL 241
+#define COLOR_CURSOR 242
+#define COLOR_BAR_FULL 243
+#define COLOR_BAR_EMPTY 244
+#define COLOR_ATTACK 245
+#define COLOR_DEFEND 246
+#define COLOR_RUN 247
+#define COLOR_PLAYER 248
+#define COLOR_ENEMY 249
+
+/* Tiles of the battle layer, made when a battle starts. */
+#define TILE_BACKDROP 0
+#define TILE_PANEL 1
+#define TILE_CURSOR_BACKDROP 2
+#define TILE_CURSOR_PANEL 3
+#define TILE_ATTACK 4
+#define TILE_DEFEND 5
+#define TILE_RUN 6
+#define TILE_PLAYER 7
+#define TILE_ENEMY 8
+/* Hit point bar tiles with 0 to 8 pixels filled. */
+#define TILE_BAR (TILE_ENEMY + BATTLE_MAX_ENEMIES)
+
+/* Hit point bars are 6 tiles, 48 pixels, long. */
+#define BAR_TILES 6
+#define BAR_PIXELS 48
+
+/* Frames between turns, so each one can be seen. */
+#define TURN_FRAMES 30
+
+/* The menu. */
+#define ACTION_ATTACK 0
+#define ACTION_DEFEND 1
+#define ACTION_RUN 2
+#define ACTION_COUNT 3
+
+/* The player is combatant 0, the enemies follow. */
+#define PLAYER 0
+#define COMBATANTS (1 + BATTLE_MAX_ENEMIES)
+
+struct Combatant
+{
+	unsigned char level, hp, max_hp, attack, defense, speed, defending;
+};
+
+/* Hit points, attack, defense and speed at each level, the player's and an enemy's. */
+const unsigned char player_stats[BATTLE_MAX_LEVEL][4] =
+{
+	{42, 9, 5, 7}, {54, 12, 7, 9}, {66, 15, 9, 11}, {78, 18, 11, 13},
+	{90, 21, 13, 15}, {102, 24, 15, 17}, {114, 27, 17, 19}, {126, 30, 19, 21},
+	{138, 33, 21, 23}, {150, 36, 23, 25}, {162, 39, 25, 27}, {174, 42, 27, 29},
+	{186, 45, 29, 31}, {198, 48, 31, 33}, {210, 51, 33, 35}, {222, 54, 35, 37},
+};
+const unsigned char enemy_stats[BATTLE_MAX_LEVEL][4] =
+{
+	{24, 8, 3, 6}, {32, 10, 5, 8}, {40, 13, 6, 10}, {48, 15, 8, 12},
+	{56, 18, 9, 14}, {64, 20, 11, 16}, {72, 23, 12, 18}, {80, 25, 14, 20},
+	{88, 28, 15, 22}, {96, 30, 17, 24}, {104, 33, 18, 26}, {112, 35, 20, 28},
+	{120, 38, 21, 30}, {128, 40, 23, 32}, {136, 43, 24, 34}, {144, 45, 26, 36},
+};
+
+/* How much of an attack gets through a defense, out of 256, 256 * 32 / (32 + defense). */
+const unsigned char defense_factor[64] =
+{
+	255, 248, 240, 234, 227, 221, 215, 210, 204, 199, 195, 190, 186, 182, 178, 174,
+	170, 167, 163, 160, 157, 154, 151, 148, 146, 143, 141, 138, 136, 134, 132, 130,
+	128, 126, 124, 122, 120, 118, 117, 115, 113, 112, 110, 109, 107, 106, 105, 103,
+	102, 101, 99, 98, 97, 96, 95, 94, 93, 92, 91, 90, 89, 88, 87, 86,
+};
+
+/* Random spread of damage, out of 256. */
+const unsigned char damage_spread[16] =
+{
+	224, 228, 232, 236, 240, 242, 244, 246, 248, 250, 252, 253, 254, 255, 255, 255,
+};
+
+/* Chance of running away out of 256, by how much faster the player is than the fastest enemy. */
+const unsigned char run_chance[8] = {32, 64, 96, 128, 160, 192, 224, 240};
+
+/*
+Scale turning hit points into bar pixels, BAR_PIXELS * 65536 / max_hp rounded up,
+so hp * bar_scale[max_hp] >> 16 is the filled length without a division.
+*/
+const unsigned int bar_scale[256] =
+{
+	0, 3145728, 1572864, 1048576, 786432, 629146, 524288, 449390,
+	393216, 349526, 314573, 285976, 262144, 241980, 224695, 209716,
+	196608, 185043, 174763, 165565, 157287, 149797, 142988, 136771,
+	131072, 125830, 120990, 116509, 112348, 108474, 104858, 101476,
+	98304, 95326, 92522, 89878, 87382, 85020, 82783, 80660,
+	78644, 76726, 74899, 73157, 71494, 69906, 68386, 66931,
+	65536, 64199, 62915, 61681, 60495, 59354, 58255, 57196,
+	56174, 55189, 54237, 53318, 52429, 51570, 50738, 49933,
+	49152, 48396, 47663, 46952, 46261, 45591, 44939, 44307,
+	43691, 43093, 42510, 41944, 41392, 40854, 40330, 39820,
+	39322, 38837, 38363, 37901, 37450, 37009, 36579, 36158,
+	35747, 35346, 34953, 34569, 34193, 33826, 33466, 33113,
+	32768, 32431, 32100, 31776, 31458, 31146, 30841, 30542,
+	30248, 29960, 29677, 29400, 29128, 28860, 28598, 28340,
+	28087, 27839, 27595, 27355, 27119, 26887, 26659, 26435,
+	26215, 25998, 25785, 25576, 25369, 25166, 24967, 24770,
+	24576, 24386, 24198, 24014, 23832, 23653, 23476, 23302,
+	23131, 22962, 22796, 22632, 22470, 22311, 22154, 21999,
+	21846, 21695, 21547, 21400, 21255, 21113, 20972, 20833,
+	20696, 20561, 20427, 20296, 20165, 20037, 19910, 19785,
+	19661, 19539, 19419, 19299, 19182, 19066, 18951, 18837,
+	18725, 18614, 18505, 18397, 18290, 18184, 18079, 17976,
+	17874, 17773, 17673, 17574, 17477, 17380, 17285, 17190,
+	17097, 17004, 16913, 16823, 16733, 16645, 16557, 16470,
+	16384, 16300, 16216, 16132, 16050, 15969, 15888, 15808,
+	15729, 15651, 15573, 15497, 15421, 15346, 15271, 15197,
+	15124, 15052, 14980, 14909, 14839, 14769, 14700, 14632,
+	14564, 14497, 14430, 14365, 14299, 14235, 14170, 14107,
+	14044, 13982, 13920, 13858, 13798, 13737, 13678, 13618,
+	13560, 13501, 13444, 13387, 13330, 13274, 13218, 13163,
+	13108, 13053, 12999, 12946, 12893, 12840, 12788, 12736,
+	12685, 12634, 12583, 12533, 12484, 12434, 12385, 12337,
+};
+
+/* Everyone in the fight, the player stays between battles. */
+struct Combatant combatants[COMBATANTS];
+int enemy_count = 0;
+
+/* The order of the current round, and how far through it the battle is. */
+unsigned char turn_queue[COMBATANTS];
+int turn_count = 0;
+int turn_index = 0;
+
+/* Menu and target cursors, frames left before the next turn, and the result to return after them. */
+int menu_choice = ACTION_ATTACK;
+int target = 1;
+int turn_delay = 0;
+enum BattleResult pending_result = BATTLE_RUNNING;
+
+/* The display settings to put back after the battle. */
+unsigned long saved_display;
+
+unsigned int random_seed = 1;
+
+/* A 16 bit random number from a linear congruential generator. */
+static unsigned int battle_random()
+{
+	random_seed = random_seed * 1664525 + 1013904223;
+	return random_seed >> 16;
+}
+
+/* Sets a combatant's stats from a table row. */
+static void set_stats(struct Combatant* combatant, const unsigned char* stats, int level)
+{
+	combatant->level = level;
+	combatant->max_hp = stats[0];
+	combatant->hp = stats[0];
+	combatant->attack = stats[1];
+	combatant->defense = stats[2];
+	combatant->speed = stats[3];
+	combatant->defending = 0;
+}
+
+void battle_init(int level)
+{
+	set_stats(&combatants[PLAYER], player_stats[level - 1], level);
+}
+
+void battle_heal()
+{
+	combatants[PLAYER].hp = combatants[PLAYER].max_hp;
+}
+
+/* The battle screen block. */
+static inline volatile unsigned short* battle_map()
+{
+	return screen_block(BATTLE_SCREEN_BLOCK);
+}
+
+/* Fills a rectangle of the battle layer with one tile. */
+static void fill_tiles(int row, int col, int height, int width, int tile)
+{
+	volatile unsigned short* map = battle_map();
+	for (int r = row; r < row + height; r++)
+	{
+		for (int c = col; c < col + width; c++)
+		{
+			map[r * 32 + c] = tile;
+		}
+	}
+}
+
+/* Makes a tile of one color. */
+static void make_solid_tile(int tile, unsigned char color)
+{
+	dma_fill(char_block(BATTLE_CHAR_BLOCK) + tile * 32, color * 0x01010101, 64);
+}
+
+/* Makes a tile from a color for each pixel, chosen by a function of x and y. */
+static void make_tile(int tile, unsigned char background, unsigned char color, int kind)
+{
+	volatile unsigned short* pixels = char_block(BATTLE_CHAR_BLOCK) + tile * 32;
+	for (int y = 0; y < 8; y++)
+	{
+		for (int x = 0; x < 8; x += 2)
+		{
+			unsigned char left = background, right = background;
+			if (kind < 0)
+			{
+				/* A cursor, a triangle pointing right. */
+				int width = ((y < 4) ? y + 1 : 8 - y) << 1;
+				if (x < width) left = color;
+				if (x + 1 < width) right = color;
+			}
+			else if (y > 0 && y < 7)
+			{
+				/* A bar tile with kind pixels filled. */
+				left = (x < kind) ? color : COLOR_BAR_EMPTY;
+				right = (x + 1 < kind) ? color : COLOR_BAR_EMPTY;
+			}
+			pixels[(y << 2) + (x >> 1)] = left | (right << 8);
+		}
+	}
+}
+
+/* Draws a hit point bar, the filled length comes from the bar_scale table. */
+static void draw_bar(int row, int col, const struct Combatant* combatant)
+{
+	int filled = (combatant->hp * bar_scale[combatant->max_hp]) >> 16;
+	if (filled > BAR_PIXELS) filled = BAR_PIXELS;
+	volatile unsigned short* map = battle_map();
+	for (int i = 0; i < BAR_TILES; i++)
+	{
+		int pixels = filled - (i << 3);
+		if (pixels < 0) pixels = 0;
+		if (pixels > 8) pixels = 8;
+		map[row * 32 + col + i] = TILE_BAR + pixels;
+	}
+}
+
+/* Draws an enemy, its bar and whether it is targeted, a beaten enemy is cleared. */
+static void draw_enemy(int index)
+{
+	int col = 3 + (index - 1) * 9;
+	if (combatants[index].hp == 0)
+	{
+		fill_tiles(2, col, 4, 4, TILE_BACKDROP);
+		fill_tiles(7, col - 1, 2, BAR_TILES, TILE_BACKDROP);
+		return;
+	}
+	fill_tiles(2, col, 4, 4, TILE_ENEMY + index - 1);
+	fill_tiles(7, col + 1, 1, 1, (index == target) ? TILE_CURSOR_BACKDROP : TILE_BACKDROP);
+	draw_bar(8, col - 1, &combatants[index]);
+}
+
+/* Draws the menu cursor next to the chosen action. */
+static void draw_menu()
+{
+	for (int i = 0; i < ACTION_COUNT; i++)
+	{
+		fill_tiles(13 + (i << 1), 1, 1, 1, (i == menu_choice) ? TILE_CURSOR_PANEL : TILE_PANEL);
+	}
+}
+
+void battle_start(const struct Encounter* encounter)
+{
+	random_seed ^= timer_ticks();
+
+	enemy_count = encounter->count;
+	for (int i = 0; i < enemy_count; i++)
+	{
+		set_stats(&combatants[1 + i], enemy_stats[encounter->level[i] - 1], encounter->level[i]);
+	}
+	for (int i = enemy_count; i < BATTLE_MAX_ENEMIES; i++)
+	{
+		combatants[1 + i].hp = 0;
+	}
+	combatants[PLAYER].defending = 0;
+	turn_count = 0;
+	turn_index = 0;
+	menu_choice = ACTION_ATTACK;
+	target = 1;
+	turn_delay = TURN_FRAMES;
+	pending_result = BATTLE_RUNNING;
+
+	/* The colors and tiles of the scene. */
+	bg_palette[COLOR_BACKDROP] = make_color(2, 2, 6);
+	bg_palette[COLOR_PANEL] = make_color(4, 6, 14);
+	bg_palette[COLOR_CURSOR] = make_color(31, 31, 31);
+	bg_palette[COLOR_BAR_FULL] = make_color(6, 28, 8);
+	bg_palette[COLOR_BAR_EMPTY] = make_color(10, 2, 2);
+	bg_palette[COLOR_ATTACK] = make_color(28, 6, 6);
+	bg_palette[COLOR_DEFEND] = make_color(6, 10, 28);
+	bg_palette[COLOR_RUN] = make_color(28, 26, 6);
+	bg_palette[COLOR_PLAYER] = make_color(20, 20, 24);
+	bg_palette[COLOR_ENEMY] = make_color(24, 8, 24);
+	bg_palette[COLOR_ENEMY + 1] = make_color(8, 24, 20);
+	bg_palette[COLOR_ENEMY + 2] = make_color(26, 16, 4);
+
+	make_solid_tile(TILE_BACKDROP, COLOR_BACKDROP);
+	make_solid_tile(TILE_PANEL, COLOR_PANEL);
+	make_tile(TILE_CURSOR_BACKDROP, COLOR_BACKDROP, COLOR_CURSOR, -1);
+	make_tile(TILE_CURSOR_PANEL, COLOR_PANEL, COLOR_CURSOR, -1);
+	make_solid_tile(TILE_ATTACK, COLOR_ATTACK);
+	make_solid_tile(TILE_DEFEND, COLOR_DEFEND);
+	make_solid_tile(TILE_RUN, COLOR_RUN);
+	make_solid_tile(TILE_PLAYER, COLOR_PLAYER);
+	for (int i = 0; i < BATTLE_MAX_ENEMIES; i++)
+	{
+		make_solid_tile(TILE_ENEMY + i, COLOR_ENEMY + i);
+	}
+	for (int i = 0; i <= 8; i++)
+	{
+		make_tile(TILE_BAR + i, COLOR_BACKDROP, COLOR_BAR_FULL, i);
+	}
+
+	/* The scene, enemies at the top, the menu, player bar and player in the panel below. */
+	fill_tiles(0, 0, 12, 32, TILE_BACKDROP);
+	fill_tiles(12, 0, 20, 32, TILE_PANEL);
+	for (int i = 1; i <= enemy_count; i++)
+	{
+		draw_enemy(i);
+	}
+	fill_tiles(13, 3, 1, 6, TILE_ATTACK);
+	fill_tiles(15, 3, 1, 6, TILE_DEFEND);
+	fill_tiles(17, 3, 1, 6, TILE_RUN);
+	draw_menu();
+	draw_bar(13, 14, &combatants[PLAYER]);
+	fill_tiles(15, 22, 3, 2, TILE_PLAYER);
+
+	*bg2_control = 0 | (BATTLE_CHAR_BLOCK << 2) | (0 << 6) | (1 << 7) | (BATTLE_SCREEN_BLOCK << 8) | (0 << 13) | (0 << 14);
+	*bg2_x_scroll = 0;
+	*bg2_y_scroll = 0;
+	saved_display = *display_control;
+	*display_control = MODE0 | BG2_ENABLE;
+}
+
+void battle_end()
+{
+	*display_control = saved_display;
+}
+
+/* Damage of one attack, from the tables with shifts and multiplies only. */
+static int damage(const struct Combatant* attacker, const struct Combatant* defender)
+{
+	int defense = (defender->defense > 63) ? 63 : defender->defense;
+	int amount = attacker->attack + (attacker->attack >> 1);
+	amount = (amount * defense_factor[defense]) >> 8;
+	unsigned int roll = battle_random();
+	amount = (amount * damage_spread[roll & 15]) >> 8;
+	/* One in 16 attacks is critical and does half as much again. */
+	if (((roll >> 4) & 15) == 0) amount += amount >> 1;
+	if (defender->defending) amount >>= 1;
+	return (amount < 1) ? 1 : amount;
+}
+
+/* Takes hit points off a combatant, they stop at 0. */
+static void hurt(struct Combatant* combatant, int amount)
+{
+	combatant->hp = (amount >= combatant->hp) ? 0 : combatant->hp - amount;
+}
+
+/* Builds the next round, everyone still standing by speed, fastest first. */
+static void build_round()
+{
+	turn_count = 0;
+	for (int i = 0; i < COMBATANTS; i++)
+	{
+		if (combatants[i].hp == 0) continue;
+		int j = turn_count++;
+		while (j > 0 && combatants[turn_queue[j - 1]].speed < combatants[i].speed)
+		{
+			turn_queue[j] = turn_queue[j - 1];
+			j--;
+		}
+		turn_queue[j] = i;
+	}
+	turn_index = 0;
+}
+
+/* Returns whether any enemy is still standing. */
+static int enemies_left()
+{
+	for (int i = 1; i <= enemy_count; i++)
+	{
+		if (combatants[i].hp) return 1;
+	}
+	return 0;
+}
+
+/* Moves the target to the next enemy still standing in a direction. */
+static void next_target(int step)
+{
+	int previous = target;
+	for (int i = 0; i < enemy_count; i++)
+	{
+		target += step;
+		if (target < 1) target = enemy_count;
+		if (target > enemy_count) target = 1;
+		if (combatants[target].hp) break;
+	}
+	draw_enemy(previous);
+	draw_enemy(target);
+}
+
+/*
+Lets the player pick an action and carries it out.
+Returns 0 while they are still choosing.
+*/
+static int player_turn()
+{
+	if (key_hit(BUTTON_UP) && menu_choice > 0)
+	{
+		menu_choice--;
+		draw_menu();
+	}
+	if (key_hit(BUTTON_DOWN) && menu_choice < ACTION_COUNT - 1)
+	{
+		menu_choice++;
+		draw_menu();
+	}
+	if (key_hit(BUTTON_LEFT)) next_target(-1);
+	if (key_hit(BUTTON_RIGHT)) next_target(1);
+	if (!key_hit(BUTTON_A))
+	{
+		return 0;
+	}
+
+	struct Combatant* player = &combatants[PLAYER];
+	player->defending = 0;
+	if (menu_choice == ACTION_ATTACK)
+	{
+		hurt(&combatants[target], damage(player, &combatants[target]));
+		draw_enemy(target);
+		if (!enemies_left())
+		{
+			pending_result = BATTLE_WON;
+		}
+		else if (combatants[target].hp == 0)
+		{
+			next_target(1);
+		}
+	}
+	else if (menu_choice == ACTION_DEFEND)
+	{
+		player->defending = 1;
+	}
+	else
+	{
+		int fastest = 0;
+		for (int i = 1; i <= enemy_count; i++)
+		{
+			if (combatants[i].hp && combatants[i].speed > fastest) fastest = combatants[i].speed;
+		}
+		int index = ((player->speed - fastest) >> 2) + 4;
+		if (index < 0) index = 0;
+		if (index > 7) index = 7;
+		if ((battle_random() & 255) < run_chance[index])
+		{
+			pending_result = BATTLE_FLED;
+		}
+	}
+	return 1;
+}
+
+/* An enemy attacks the player. */
+static void enemy_turn(int index)
+{
+	hurt(&combatants[PLAYER], damage(&combatants[index], &combatants[PLAYER]));
+	draw_bar(13, 14, &combatants[PLAYER]);
+	if (combatants[PLAYER].hp == 0)
+	{
+		pending_result = BATTLE_LOST;
+	}
+}
+
+enum BattleResult battle_update()
+{
+	if (turn_delay > 0)
+	{
+		turn_delay--;
+		return BATTLE_RUNNING;
+	}
+	if (pending_result != BATTLE_RUNNING)
+	{
+		/* Winning raises the player a level, to the new level's full hit points. */
+		if (pending_result == BATTLE_WON && combatants[PLAYER].level < BATTLE_MAX_LEVEL)
+		{
+			battle_init(combatants[PLAYER].level + 1);
+		}
+		return pending_result;
+	}
+
+	if (turn_index >= turn_count)
+	{
+		build_round();
+	}
+	int current = turn_queue[turn_index];
+	if (combatants[current].hp == 0)
+	{
+		/* Beaten before their turn came. */
+		turn_index++;
+		return BATTLE_RUNNING;
+	}
+	if (current == PLAYER)
+	{
+		if (!player_turn())
+		{
+			return BATTLE_RUNNING;
+		}
+	}
+	else
+	{
+		enemy_turn(current);
+	}
+	turn_index++;
+	turn_delay = TURN_FRAMES;
+	return BATTLE_RUNNING;
+}
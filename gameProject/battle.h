@@ -0,0 +1,47 @@
+/*
+Turn based battles, drawn on bg2 over the map.
+The stats and damage come from lookup tables, with only shifts and multiplies at run time,
+so every turn resolves in a fraction of a frame.
+*/
+
+#ifndef BATTLE_H
+#define BATTLE_H
+
+/* Up to 3 enemies fight the player at once. */
+#define BATTLE_MAX_ENEMIES 3
+
+/* Levels run from 1 to BATTLE_MAX_LEVEL. */
+#define BATTLE_MAX_LEVEL 16
+
+/* What battle_update returns. */
+enum BattleResult
+{
+	BATTLE_RUNNING,
+	BATTLE_WON,
+	BATTLE_LOST,
+	BATTLE_FLED,
+};
+
+/* The enemies of a fight, by level. */
+struct Encounter
+{
+	unsigned char count;
+	unsigned char level[BATTLE_MAX_ENEMIES];
+};
+
+/* Sets the player's level and heals them, done once at start up. */
+void battle_init(int level);
+
+/* Restores the player's hit points. */
+void battle_heal();
+
+/* Draws the battle scene on bg2 and turns the map layers and sprites off. */
+void battle_start(const struct Encounter* encounter);
+
+/* Runs one frame of the battle, call once a frame after input_update. */
+enum BattleResult battle_update();
+
+/* Turns the map layers and sprites back on. */
+void battle_end();
+
+#endif
@@ -2,56 +2,31 @@
 GBA game that mimics old JRPG, based off of Final Fantasy series.
 */
 
-/* First map and tile of the game. */
-#include "map1.h"
-#include "map1tile.h"
-#include "map1boundary.h"
-/* Second map and tile of the game. */
-#include "map2.h"
-#include "map2tile.h"
-#include "map2boundary.h"
-
-/* Sprites for the game. */
-#include "sprites.h"
+/* Shared hardware definitions, DMA, asset loading, input, interrupts, timers and map streaming. */
+#include "../gba.h"
+#include "../dma.h"
+#include "../asset.h"
+#include "../input.h"
+#include "../interrupt.h"
+#include "../timer.h"
+#include "../metatile.h"
+#include "../stream.h"
+#include "battle.h"
 
-/* The size of the GBA screen. */
-#define WIDTH 240
-#define HEIGHT 160
-
-/* DMA flags. */
-#define DMA_ENABLE 0x80000000
-#define DMA_16 0x00000000
-#define DMA_32 0x04000000
-
-/* DMA registers. */
-volatile unsigned int* dma_source = (volatile unsigned int*) 0x40000D4;
-volatile unsigned int* dma_destination = (volatile unsigned int*) 0x40000D8;
-volatile unsigned int* dma_count = (volatile unsigned int*) 0x40000DC;
-
-/* Flags for sprite handling in display control register. */
-#define SPRITE_MAP_2D 0x0
-#define SPRITE_MAP_1D 0x40
-#define SPRITE_ENABLE 0x1000
-
-/* The three tile modes. */
-#define MODE0 0x00
-#define MODE1 0x01
-#define MODE2 0x02
-
-/* Bits for the four tile layers. */
-#define BG0_ENABLE 0x100
-#define BG1_ENABLE 0x200
-#define BG2_ENABLE 0x400
-#define BG3_ENABLE 0x800
-
-/* Control registers for the four tile layers. */
-volatile unsigned short* bg0_control = (volatile unsigned short*) 0x4000008;
-volatile unsigned short* bg1_control = (volatile unsigned short*) 0x400000a;
-volatile unsigned short* bg2_control = (volatile unsigned short*) 0x400000c;
-volatile unsigned short* bg3_control = (volatile unsigned short*) 0x400000e;
-
-/* Pallete size. */
-#define PALETTE_SIZE 256
+/*
+First map of the game, its tiles and metatiles.
+The packed headers are the png2gba ones with repeated tiles removed by tools/tilegen,
+the metatile headers are made from the tile and boundary headers by tools/metagen,
+and the lz headers are the packed ones with the image LZ77 compressed by tools/gbacomp.
+*/
+#include "map1lz.h"
+#include "map1meta.h"
+/* Second map of the game, its tiles and metatiles. */
+#include "map2lz.h"
+#include "map2meta.h"
+
+/* Sprites for the game, kept uncompressed so single frames can be copied out of it. */
+#include "sprites.h"
 
 /* Sprite size. */
 #define NUM_SPRITES 128
@@ -73,111 +48,174 @@ enum SpriteSize
 	SIZE_64_64,
 };
 
-/* An array of all sprites to be used for the game. */
-struct Sprite sprites[NUM_SPRITES];
-int next_sprite_index = 0;
+/* Attribute 0 bit which turns a sprite off. */
+#define SPRITE_HIDE (1 << 9)
 
-/* Display control pointer points to the GBA graphics register. */
-volatile unsigned long* display_control = (volatile unsigned long*) 0x4000000;
+/* An array of all sprites to be used for the game, a shadow of OAM which is uploaded in vblank. */
+struct Sprite sprites[NUM_SPRITES] __attribute__((aligned(4)));
 
-/* Address of the color palette. */
-volatile unsigned short* bg_palette = (volatile unsigned short*) 0x5000000;
-volatile unsigned short* sprite_palette = (volatile unsigned short*) 0x5000200;
+/* Stack of the free sprite slots, allocating and freeing a slot is a pop or a push. */
+unsigned char sprite_free_list[NUM_SPRITES];
+int sprite_free_count = 0;
 
-/* Address of the sprite image data. */
-volatile unsigned short* sprite_image_memory = (volatile unsigned short*) 0x6010000;
+/*
+Sprite image memory is handed out in blocks of 8 tile units (256 bytes), one 16x16 frame at 8bpp.
+A tile unit is 32 bytes, the step of a sprite's tile index in 1D mapping.
+*/
+#define SPRITE_TILE_BLOCK 8
+#define SPRITE_TILE_BLOCKS 128
 
-/* Address of the sprite attributes. */
-volatile unsigned short* sprite_attribute_memory = (volatile unsigned short*) 0x7000000;
+/* One bit per block of sprite image memory, set when it is in use. */
+unsigned int sprite_tile_used[SPRITE_TILE_BLOCKS / 32];
 
-/* Button register. */
-volatile unsigned short* buttons = (volatile unsigned short*) 0x04000130;
+/* The range of sprites changed since the last upload, empty when low is past high. */
+int sprite_dirty_low = 0;
+int sprite_dirty_high = NUM_SPRITES - 1;
+
+/* Marks a sprite as changed so the next upload includes it. */
+static inline void sprite_touch(struct Sprite* sprite)
+{
+	int index = sprite - sprites;
+	if (index < sprite_dirty_low) sprite_dirty_low = index;
+	if (index > sprite_dirty_high) sprite_dirty_high = index;
+}
+
+/* How a clip carries on after its last frame. */
+#define LOOP_REPEAT 0
+#define LOOP_ONCE 1
+#define LOOP_PINGPONG 2
+
+/* One animation, its frames are tile_step tiles apart in the sprite sheet. */
+struct AnimationClip
+{
+	unsigned short start_tile;
+	unsigned char frame_count, frame_duration, loop_mode, tile_step;
+};
+
+/* The states a character can be animated in, each has a clip per direction. */
+enum AnimationState
+{
+	ANIM_STAND,
+	ANIM_WALK,
+	ANIM_COUNT,
+};
 
-/* Scrolling background registers. */
-volatile short* bg0_x_scroll = (unsigned short*) 0x4000010;
-volatile short* bg0_y_scroll = (unsigned short*) 0x4000012;
-volatile short* bg1_x_scroll = (unsigned short*) 0x4000014;
-volatile short* bg1_y_scroll = (unsigned short*) 0x4000016;
-volatile short* bg2_x_scroll = (unsigned short*) 0x4000018;
-volatile short* bg2_y_scroll = (unsigned short*) 0x400001a;
-volatile short* bg3_x_scroll = (unsigned short*) 0x400001c;
-volatile short* bg3_y_scroll = (unsigned short*) 0x400001e;
+/* Directions, in the order clips are listed. */
+#define DIRECTION_DOWN 0
+#define DIRECTION_LEFT 1
+#define DIRECTION_UP 2
+#define DIRECTION_RIGHT 3
 
-/* Selects which button based on bit position. */
-#define BUTTON_A (1 << 0)
-#define BUTTON_B (1 << 1)
-#define BUTTON_SELECT (1 << 2)
-#define BUTTON_START (1 << 3)
-#define BUTTON_RIGHT (1 << 4)
-#define BUTTON_LEFT (1 << 5)
-#define BUTTON_UP (1 << 6)
-#define BUTTON_DOWN (1 << 7)
-#define BUTTON_R (1 << 8)
-#define Button_L (1 << 9)
+/* The clips of a sprite sheet, by state and direction. */
+typedef struct AnimationClip AnimationSet[ANIM_COUNT][4];
 
-/* Scanline counter updates how much of the screen has been drawn. */
-volatile unsigned short* scanline_counter = (volatile unsigned short*) 0x4000006;
+/*
+The hero in sprites.png, each 16x16 frame is 8 tiles at 8bpp.
+Other sheets, such as battleSpriteSheet.png and bossSpriteSheet.png, only need a table like this.
+*/
+const AnimationSet hero_animations =
+{
+	/* Standing, down, left, up and right. */
+	{{0, 1, 1, LOOP_ONCE, 8}, {32, 1, 1, LOOP_ONCE, 8}, {16, 1, 1, LOOP_ONCE, 8}, {48, 1, 1, LOOP_ONCE, 8}},
+	/* Walking. */
+	{{0, 2, 5, LOOP_REPEAT, 8}, {32, 2, 5, LOOP_REPEAT, 8}, {16, 2, 5, LOOP_REPEAT, 8}, {48, 2, 5, LOOP_REPEAT, 8}},
+};
 
-/* This waits for the vblank cycle. */
-void wait_vblank()
+/*
+Advances a clip by one frame of time and returns non zero when the shown frame changed.
+A ping pong clip counts through 2 * frame_count - 2 steps and shows them forwards then back.
+*/
+static inline int animation_advance(const struct AnimationClip* clip, unsigned char* step, unsigned char* timer)
 {
-	while (*scanline_counter < 160)
+	if (++*timer < clip->frame_duration)
 	{
-		/* Do nothing. */
+		return 0;
 	}
+	*timer = 0;
+	int steps = (clip->loop_mode == LOOP_PINGPONG && clip->frame_count > 1) ? 2 * clip->frame_count - 2 : clip->frame_count;
+	if (*step + 1 < steps)
+	{
+		++*step;
+		return 1;
+	}
+	if (clip->loop_mode == LOOP_ONCE)
+	{
+		return 0;
+	}
+	*step = 0;
+	return steps > 1;
+}
+
+/* The tile offset of a step of a clip. */
+static inline int animation_tile(const struct AnimationClip* clip, int step)
+{
+	int frame = (step < clip->frame_count) ? step : 2 * clip->frame_count - 2 - step;
+	return clip->start_tile + frame * clip->tile_step;
 }
 
 /* A struct for each character's logic and behavior. */
 struct Character
 {
 	struct Sprite* sprite;
-	int x, y, frame, animation_delay, counter, move, direction, border;
+	int x, y, move, direction, border;
+
+	/* Clips of the character's sprite sheet, the one playing and how far through it is. */
+	const AnimationSet* animations;
+	const struct AnimationClip* clip;
+	unsigned char step, timer;
 };
 
-/* This checks if a button has been pressed and return a true(1) or false(0). */
-unsigned char button_pressed(unsigned short button)
-{
-	unsigned short pressed = *buttons & button;
-	return (pressed == 0) ? 1 : 0;
-}
+/*
+The visible map on bg1 and the boundary map on bg0 are streamed into their screen blocks from the metatiles,
+so a map can be any size, only the tiles coming into view are expanded and copied as it scrolls.
+*/
+struct StreamMap background_stream;
+struct StreamMap boundary_stream;
 
-/* This returns a pointer to one of the 4 character blocks (0-3). */
-volatile unsigned short* char_block(unsigned long block)
-{
-	return (volatile unsigned short*) (0x6000000 + (block * 0x4000));
-}
+/* The metatile map of the current level, which also holds the collision kind of every tile. */
+const struct MetatileMap* world;
+
+/* Size of the current map in tiles. */
+int world_width = 32;
+int world_height = 32;
 
-/* This returns a pointer to one of the 32 screen blocks (0-31). */
-volatile unsigned short* screen_block(unsigned long block)
+/* This map is drawn on bg1 for visible game map, the asset only supplies the image and palette. */
+void setup_background(const struct TileAsset* asset, int xscroll, int yscroll)
 {
-	return (volatile unsigned short*) (0x6000000 + (block * 0x800));
+	asset_load_image(asset, 0);
+	stream_init_metatiles(&background_stream, world, METATILE_VISIBLE, 16, xscroll, yscroll);
+	*bg1_control = 1 | (0 << 2) | (0 << 6) | asset_color_mode(asset) | (16 << 8) | (1 << 13) | (0 << 14);
 }
 
-/* DMA copy. */
-void memcpy16(unsigned short* dest, const unsigned short* source, int amount)
+/* The kinds of tile in a metatile map, these are also what tile_interact returns. */
+#define TILE_WALK 0
+#define TILE_BLOCK 1
+#define TILE_INTERACT 2
+#define TILE_WARP 3
+
+/* Returns the kind of a tile from the metatile map, x and y must already be wrapped. */
+static inline unsigned int tile_kind(int x, int y)
 {
-	*dma_source = (unsigned int) source;
-	*dma_destination = (unsigned int) dest;
-	*dma_count = amount | DMA_16 |DMA_ENABLE;
+	return metatile_collision(world, x, y);
 }
 
-/* This map is drawn on bg1 for visible game map. */
-void setup_background(const unsigned char* map_data, const unsigned short* map_palette, unsigned short map_width, unsigned short map_height, const unsigned short* tile, unsigned short tile_width, unsigned short tile_height)
+/* This map is drawn on bg0 for playable boundaries, from the same tiles as the visible map. */
+void setup_boundary(const struct TileAsset* asset, int xscroll, int yscroll)
 {
-	memcpy16((unsigned short*) bg_palette, (unsigned short*) map_palette, PALETTE_SIZE);
-	volatile unsigned short* dest = char_block(0);
-	memcpy16((unsigned short*) dest, (const unsigned short*) map_data, (map_width * map_height) / 2);
-	dest = screen_block(16);
-	memcpy16((unsigned short*) dest, (const unsigned short*) tile, (tile_width * tile_height));
-	*bg1_control = 1 | (0 << 2) | (0 << 6) | (1 << 7) | (16 << 8) | (1 << 13) | (0 << 14);
+	stream_init_metatiles(&boundary_stream, world, METATILE_BOUNDARY, 17, xscroll, yscroll);
+	*bg0_control = 0 | (0 << 2) | (0 << 6) | asset_color_mode(asset) | (17 << 8) | (1 << 13) | (0 << 14);
 }
 
-/* This map is drawn on bg0 for playable boundaries. */
-void setup_boundary(const unsigned short* tile, unsigned short tile_width, unsigned short tile_height)
+/*
+Wraps a tile coordinate into 0 to size - 1 in constant time.
+Maps with a power of 2 size, such as 32x32, only need a single mask.
+The scroll itself is never wrapped, the map streams and these lookups wrap world coordinates themselves.
+*/
+static inline int wrap_tile(int coord, int size)
 {
-	volatile unsigned short* dest = screen_block(17);
-	memcpy16((unsigned short*) dest, (const unsigned short*) tile, (tile_width * tile_height));
-	*bg0_control = 0 | (0 << 2) | (0 << 6) | (1 << 7) | (17 << 8) | (1 << 13) | (0 << 14);
+	if ((size & (size - 1)) == 0) return coord & (size - 1);
+	coord %= size;
+	return (coord < 0) ? coord + size : coord;
 }
 
 /*
@@ -187,58 +225,137 @@ Looks up what kind of tile it is and return a number that will determine what ac
 	2 - Interaction tile, perform specific action.
 	3 - New map tile, load new map into screen.
  */
-unsigned short tile_interact(int x_coord, int y_coord, int xscroll, int yscroll, const unsigned short* boundary, int boundary_width, int boundary_height, unsigned short new_map_tile, unsigned short interaction_tile, unsigned short boundary_tile)
+unsigned short tile_interact(int x_coord, int y_coord, int xscroll, int yscroll)
 {
 	x_coord += xscroll;
 	y_coord += yscroll;
 	x_coord >>= 3;
 	y_coord >>= 3;
-	
-	while (x_coord >= boundary_width) x_coord -= boundary_width;
-	while (y_coord >= boundary_height) y_coord -= boundary_height;
-	while (x_coord < 0) x_coord += boundary_width;
-	while (y_coord < 0) y_coord += boundary_height;
-	int index = y_coord * boundary_width + x_coord;
-
-	if (boundary[index] == new_map_tile) return 3;
-	else if (boundary[index] == interaction_tile) return 2;
-	else if (boundary[index] == boundary_tile) return 1;
-	else return 0;
+	return tile_kind(wrap_tile(x_coord, world_width), wrap_tile(y_coord, world_height));
 }
 
-unsigned short move_collision(struct Character* character, int xscroll, int yscroll, const unsigned short* boundary, int boundary_width, int boundary_height, unsigned short boundary_tile)
+/*
+Checks the tiles next to the character for a boundary and returns the first blocked direction:
+	0 - Down, 1 - Left, 2 - Up, 3 - Right, 4 - None.
+*/
+unsigned short move_collision(struct Character* character, int xscroll, int yscroll)
 {
 	int x_coord = character->x + xscroll + 16;
 	int y_coord = character->y + yscroll + 16;
 	x_coord >>= 3;
 	y_coord >>= 3;
-	
-	while (x_coord >= boundary_width) x_coord -= boundary_width;
-	while (y_coord >= boundary_height) y_coord -= boundary_height;
-	while (x_coord < 0) x_coord += boundary_width;
-	while (y_coord < 0) y_coord += boundary_height;
-	int up = (y_coord - 1) * boundary_width + x_coord;
-	int down = (y_coord + 1) * boundary_width + x_coord;
-	int left = y_coord * boundary_width + (x_coord - 1);
-	int right = y_coord * boundary_width + (x_coord + 1);
-
-	if (boundary[down] == boundary_tile) return 0;
-	else if (boundary[left] == boundary_tile) return 1;
-	else if (boundary[up] == boundary_tile) return 2;
-	else if (boundary[right] == boundary_tile) return 3;
-}
-
-/* Setup the sprite image and palette. */
+	x_coord = wrap_tile(x_coord, world_width);
+	y_coord = wrap_tile(y_coord, world_height);
+	/* The neighbours wrap too, so a character at the map edge stays in the grid. */
+	int up = wrap_tile(y_coord - 1, world_height);
+	int down = wrap_tile(y_coord + 1, world_height);
+	int left = wrap_tile(x_coord - 1, world_width);
+	int right = wrap_tile(x_coord + 1, world_width);
+
+	if (tile_kind(x_coord, down) == TILE_BLOCK) return 0;
+	else if (tile_kind(left, y_coord) == TILE_BLOCK) return 1;
+	else if (tile_kind(x_coord, up) == TILE_BLOCK) return 2;
+	else if (tile_kind(right, y_coord) == TILE_BLOCK) return 3;
+	else return 4;
+}
+
+/* Reserves tile units of sprite image memory and returns the first tile index, or -1 when there is no room. */
+int sprite_tiles_alloc(int units)
+{
+	int blocks = (units + SPRITE_TILE_BLOCK - 1) / SPRITE_TILE_BLOCK;
+	int run = 0;
+	for (int i = 0; i < SPRITE_TILE_BLOCKS; i++)
+	{
+		/* Skip a whole word of used blocks at once. */
+		if ((i & 31) == 0 && sprite_tile_used[i >> 5] == 0xffffffff)
+		{
+			run = 0;
+			i += 31;
+			continue;
+		}
+		if (sprite_tile_used[i >> 5] & (1u << (i & 31)))
+		{
+			run = 0;
+			continue;
+		}
+		if (++run == blocks)
+		{
+			int first = i - blocks + 1;
+			for (int j = first; j <= i; j++)
+			{
+				sprite_tile_used[j >> 5] |= 1u << (j & 31);
+			}
+			return first * SPRITE_TILE_BLOCK;
+		}
+	}
+	return -1;
+}
+
+/* Returns tile units from sprite_tiles_alloc. */
+void sprite_tiles_free(int tile_index, int units)
+{
+	int first = tile_index / SPRITE_TILE_BLOCK;
+	int blocks = (units + SPRITE_TILE_BLOCK - 1) / SPRITE_TILE_BLOCK;
+	for (int j = first; j < first + blocks; j++)
+	{
+		sprite_tile_used[j >> 5] &= ~(1u << (j & 31));
+	}
+}
+
+/* Changes the tile offset of a sprite. */
+void sprite_set_offset(struct Sprite* sprite, int offset)
+{
+	unsigned short attribute2 = (sprite->attribute2 & 0xfc00) | (offset & 0x03ff);
+	if (attribute2 != sprite->attribute2)
+	{
+		sprite->attribute2 = attribute2;
+		sprite_touch(sprite);
+	}
+}
+
+/* Turns a sprite off or back on with the hide bit, the rest of its attributes are kept. */
+void sprite_hide(struct Sprite* sprite, int hidden)
+{
+	unsigned short attribute0 = hidden ? (sprite->attribute0 | SPRITE_HIDE) : (sprite->attribute0 & ~SPRITE_HIDE);
+	if (attribute0 != sprite->attribute0)
+	{
+		sprite->attribute0 = attribute0;
+		sprite_touch(sprite);
+	}
+}
+
+/* Setup the sprite palette, the images are streamed a frame at a time by sprite_show_frame. */
 void setup_sprite_image()
 {
-	memcpy16((unsigned short*) sprite_palette, (unsigned short*) sprites_palette, PALETTE_SIZE);
-	memcpy16((unsigned short*) sprite_image_memory, (unsigned short*) sprites_data, (sprites_width * sprites_height) / 2);
+	dma_copy(sprite_palette, sprites_palette, PALETTE_SIZE * 2);
 }
 
-/* Initialize a sprite with necessary properties and return a pointer. */
+/* Tile units of sprite image memory needed for one frame of each size, at 8bpp. */
+const unsigned char sprite_size_units[] = {8, 16, 128};
+
+/*
+Frame streaming, a sprite made by sprite_init_streamed owns one frame's worth of sprite image memory
+and the frame it shows is copied there from its sheet in ROM, so sheets can be far bigger than the 32KB.
+These are by sprite slot, sprite_frame_tile is -1 for a sprite which is not streamed.
+*/
+short sprite_frame_tile[NUM_SPRITES];
+short sprite_frame_units[NUM_SPRITES];
+short sprite_frame_loaded[NUM_SPRITES];
+const unsigned char* sprite_frame_sheet[NUM_SPRITES];
+
+/* Sprites whose frame changed since the last sprite_stream_commit. */
+unsigned char sprite_frame_queue[NUM_SPRITES];
+unsigned char sprite_frame_queued[NUM_SPRITES];
+int sprite_frame_queue_count = 0;
+
+/* Initialize a sprite with necessary properties and return a pointer, or 0 when every slot is taken. */
 struct Sprite* sprite_init(int x_coord, int y_coord, enum SpriteSize dimension, int tile_index, int priority)
 {
-	int index = next_sprite_index++;
+	if (sprite_free_count == 0)
+	{
+		return 0;
+	}
+	int index = sprite_free_list[--sprite_free_count];
 	int size, shape;
 	switch (dimension)
 	{
@@ -258,16 +375,109 @@ struct Sprite* sprite_init(int x_coord, int y_coord, enum SpriteSize dimension,
 	sprites[index].attribute0 = y_coord | (0 << 8) | (0 << 10) | (0 << 12) | (1 << 13) | (shape << 14);
 	sprites[index].attribute1 = x_coord | (0 << 9) | (0 << 12) | (0 << 13) | (size << 14);
 	sprites[index].attribute2 = tile_index | (priority << 10) | (0 << 12);
+	sprite_frame_tile[index] = -1;
+	sprite_touch(&sprites[index]);
 	return &sprites[index];
 }
 
-/* Set a sprite's position. */
+/* Initialize a sprite which streams its frames from a sheet, it returns 0 when there is no slot or image memory left. */
+struct Sprite* sprite_init_streamed(int x_coord, int y_coord, enum SpriteSize dimension, const unsigned char* sheet, int priority)
+{
+	int units = sprite_size_units[dimension];
+	int tile = sprite_tiles_alloc(units);
+	if (tile < 0)
+	{
+		return 0;
+	}
+	struct Sprite* sprite = sprite_init(x_coord, y_coord, dimension, tile, priority);
+	if (sprite == 0)
+	{
+		sprite_tiles_free(tile, units);
+		return 0;
+	}
+	int index = sprite - sprites;
+	sprite_frame_tile[index] = tile;
+	sprite_frame_units[index] = units;
+	sprite_frame_loaded[index] = -1;
+	sprite_frame_sheet[index] = sheet;
+	return sprite;
+}
+
+/*
+Shows the frame at a tile offset of the sprite's sheet.
+The copy waits for sprite_stream_commit, and nothing is copied when the frame is already there.
+*/
+void sprite_show_frame(struct Sprite* sprite, int sheet_tile)
+{
+	int index = sprite - sprites;
+	if (sprite_frame_tile[index] < 0)
+	{
+		sprite_set_offset(sprite, sheet_tile);
+		return;
+	}
+	if (sprite_frame_loaded[index] == sheet_tile)
+	{
+		return;
+	}
+	sprite_frame_loaded[index] = sheet_tile;
+	if (!sprite_frame_queued[index])
+	{
+		sprite_frame_queued[index] = 1;
+		sprite_frame_queue[sprite_frame_queue_count++] = index;
+	}
+}
+
+/*
+Bytes of frames copied per vblank, 16 frames of 16x16 at 8bpp.
+This keeps the copies to a fraction of vblank however many sprites animate, the rest wait for the next one.
+*/
+#define SPRITE_STREAM_BYTES 4096
+
+/* Copies the frames which changed into sprite image memory, up to SPRITE_STREAM_BYTES, call in vblank. */
+void sprite_stream_commit()
+{
+	int budget = SPRITE_STREAM_BYTES;
+	int i = 0;
+	for (; i < sprite_frame_queue_count; i++)
+	{
+		int index = sprite_frame_queue[i];
+		/* A sprite freed since its frame was queued, or not given a frame yet, has nothing to copy. */
+		if (sprite_frame_tile[index] < 0 || sprite_frame_loaded[index] < 0)
+		{
+			sprite_frame_queued[index] = 0;
+			continue;
+		}
+		int bytes = sprite_frame_units[index] * 32;
+		if (bytes > budget && budget < SPRITE_STREAM_BYTES)
+		{
+			break;
+		}
+		budget -= bytes;
+		sprite_frame_queued[index] = 0;
+		/* Tile units are 32 bytes, 16 halfwords of sprite image memory. */
+		dma_copy(sprite_image_memory + sprite_frame_tile[index] * 16,
+			sprite_frame_sheet[index] + sprite_frame_loaded[index] * 32, bytes);
+	}
+	/* Frames left over move to the front of the queue, still in order. */
+	int left = sprite_frame_queue_count - i;
+	for (int j = 0; j < left; j++)
+	{
+		sprite_frame_queue[j] = sprite_frame_queue[i + j];
+	}
+	sprite_frame_queue_count = left;
+}
+
+/* Set a sprite's position, it only counts as changed when it actually moves. */
 void sprite_position(struct Sprite* sprite, int x_coord, int y_coord)
 {
-	sprite->attribute0 &= 0xff00;
-	sprite->attribute0 |= (y_coord & 0xff);
-	sprite->attribute1 &= 0xfe00;
-	sprite->attribute1 |= (x_coord & 0x1ff);
+	unsigned short attribute0 = (sprite->attribute0 & 0xff00) | (y_coord & 0xff);
+	unsigned short attribute1 = (sprite->attribute1 & 0xfe00) | (x_coord & 0x1ff);
+	if (attribute0 != sprite->attribute0 || attribute1 != sprite->attribute1)
+	{
+		sprite->attribute0 = attribute0;
+		sprite->attribute1 = attribute1;
+		sprite_touch(sprite);
+	}
 }
 
 /* Moves a sprite in a direction. */
@@ -278,27 +488,64 @@ void sprite_move(struct Sprite* sprite, int dx, int dy)
 	sprite_position(sprite, x + dx, y + dy);
 }
 
-/* Changes the tile offset of a sprite. */
-void sprite_set_offset(struct Sprite* sprite, int offset)
+/* Uploads the sprites changed since the last call, call in vblank. */
+void sprite_update_all()
 {
-	sprite->attribute2 &= 0xfc00;
-	sprite->attribute2 |= (offset & 0x03ff);
+	if (sprite_dirty_low > sprite_dirty_high)
+	{
+		return;
+	}
+	/* Each sprite is 4 halfwords of OAM, so the range stays 32-bit aligned. */
+	dma_copy(sprite_attribute_memory + sprite_dirty_low * 4, &sprites[sprite_dirty_low],
+		(sprite_dirty_high - sprite_dirty_low + 1) * sizeof(struct Sprite));
+	sprite_dirty_low = NUM_SPRITES;
+	sprite_dirty_high = -1;
 }
 
-/* This updates all of the sprites on the screen. */
-void sprite_update_all()
+/* Hides a sprite and puts its slot back on the free list. */
+void sprite_free(struct Sprite* sprite)
 {
-	memcpy16((unsigned short*) sprite_attribute_memory, (unsigned short*) sprites, NUM_SPRITES * 4);
+	int index = sprite - sprites;
+	if (sprite_frame_tile[index] >= 0)
+	{
+		sprite_tiles_free(sprite_frame_tile[index], sprite_frame_units[index]);
+		sprite_frame_tile[index] = -1;
+	}
+	sprite_hide(sprite, 1);
+	sprite_free_list[sprite_free_count++] = sprite - sprites;
 }
 
-/* This clears all sprite from visible map and moves them offscreen. */
+/* This hides every sprite with one attribute write each and frees every slot, the next upload sends them all. */
 void sprite_clear()
 {
-	next_sprite_index = 0;
+	/* Lower slots come off the stack first, so they are drawn on top. */
+	sprite_free_count = NUM_SPRITES;
 	for (int i = 0; i < NUM_SPRITES; i++)
 	{
-		sprites[i].attribute0 = HEIGHT;
-		sprites[i].attribute1 = WIDTH;
+		sprites[i].attribute0 = SPRITE_HIDE;
+		sprite_free_list[i] = NUM_SPRITES - 1 - i;
+		sprite_frame_tile[i] = -1;
+		sprite_frame_queued[i] = 0;
+	}
+	sprite_frame_queue_count = 0;
+	for (int i = 0; i < SPRITE_TILE_BLOCKS / 32; i++)
+	{
+		sprite_tile_used[i] = 0;
+	}
+	sprite_dirty_low = 0;
+	sprite_dirty_high = NUM_SPRITES - 1;
+}
+
+/* Plays a state's clip in the character's direction, it starts over only when the clip changes. */
+void character_animate(struct Character* character, enum AnimationState state)
+{
+	const struct AnimationClip* clip = &(*character->animations)[state][character->direction];
+	if (clip != character->clip)
+	{
+		character->clip = clip;
+		character->step = 0;
+		character->timer = 0;
+		sprite_show_frame(character->sprite, animation_tile(clip, 0));
 	}
 }
 
@@ -308,37 +555,25 @@ void character_init(struct Character* character, int x_coord, int y_coord, enum
 	character->x = x_coord;
 	character->y = y_coord;
 	character->border = 40;
-	character->frame = 0;
 	character->move = 0;
-	switch (character->direction)
-	{
-		case 0:
-			character->frame = 0;
-			break;
-		case 1:
-			character->frame = 32;
-			break;
-		case 2:
-			character->frame = 16;
-			break;
-		case 3:
-			character->frame = 48;
-			break;
-	}
-	character->counter = 4;
-	character->animation_delay = 5;
-	character->sprite = sprite_init(x_coord, y_coord, size, 0, 0);
+	character->animations = &hero_animations;
+	character->clip = 0;
+	character->sprite = sprite_init_streamed(x_coord, y_coord, size, sprites_data, 0);
+	character_animate(character, ANIM_STAND);
+}
+
+/* Starts the character walking in a direction. */
+static void character_walk(struct Character* character, int direction)
+{
+	character->move = 1;
+	character->direction = direction;
+	character_animate(character, ANIM_WALK);
 }
 
 /* Moves the character left and if at the border limit, move map instead. */
 int character_left(struct Character* character)
 {
-	if (character->move == 0)
-	{
-		character->frame = 32;
-	}
-	character->move = 1;
-	character->direction = 1;
+	character_walk(character, DIRECTION_LEFT);
 	if (character->x < character->border)
 	{
 		return 1;
@@ -353,12 +588,7 @@ int character_left(struct Character* character)
 /* Moves the character right and if at the border limit, move map instead. */
 int character_right(struct Character* character)
 {
-	if (character->move == 0)
-	{
-		character->frame = 48;
-	}
-	character->move = 1;
-	character->direction = 3;
+	character_walk(character, DIRECTION_RIGHT);
 	if (character->x > (WIDTH - character->border))
 	{
 		return 1;
@@ -373,12 +603,7 @@ int character_right(struct Character* character)
 /* Moves the character up and if at the border limit, move map instead. */
 int character_up(struct Character* character)
 {
-	if (character->move == 0)
-	{
-		character->frame = 16;
-	}
-	character->move = 1;
-	character->direction = 2;
+	character_walk(character, DIRECTION_UP);
 	if (character->y < character->border)
 	{
 		return 1;
@@ -393,12 +618,7 @@ int character_up(struct Character* character)
 /* Moves the character down and if a t the border limit, move map instead. */
 int character_down(struct Character* character)
 {
-	if (character->move == 0)
-	{
-		character->frame = 0;
-	}
-	character->move = 1;
-	character->direction = 0;
+	character_walk(character, DIRECTION_DOWN);
 	if (character->y > (HEIGHT - character->border))
 	{
 		return 1;
@@ -410,180 +630,383 @@ int character_down(struct Character* character)
 	}
 }
 
-/* If no input detected, stops character sprite animation, and reset frame back to 0. */
+/* If no input detected, stops character sprite animation and stands facing the same way. */
 void character_stop(struct Character* character)
 {
 	character->move = 0;
-	character->counter = 4;
-	switch (character->direction)
-	{
-		case 0:
-			character->frame = 0;
-			break;
-		case 1:
-			character->frame = 32;
-			break;
-		case 2:
-			character->frame = 16;
-			break;
-		case 3:
-			character->frame = 48;
-			break;
-	}
-	sprite_set_offset(character->sprite, character->frame);
+	character_animate(character, ANIM_STAND);
 }
 
 /* Updates the character sprite. */
 void character_update(struct Character* character)
 {
-	if (character->move)
+	if (animation_advance(character->clip, &character->step, &character->timer))
 	{
-		character->counter++;
-		if (character->counter >= character->animation_delay)
-		{
-			switch (character->direction)
-			{
-				case 0:		
-					character->frame += 8;
-					if (character->frame > 8)
-					{
-						character->frame = 0;
-					}
-					break;
-				case 1:
-					character->frame += 8;
-					if (character->frame > 40)
-					{
-						character->frame = 32;
-					}
-					break;
-				case 2:
-					character->frame += 8;
-					if (character->frame > 24)
-					{
-						character->frame = 16;
-					}
-					break;
-				case 3:
-					character->frame += 8;
-					if (character->frame > 56)
-					{
-						character->frame = 48;
-					}
-					break;
-			}
-			sprite_set_offset(character->sprite, character->frame);
-			character->counter = 0;
-		}
+		sprite_show_frame(character->sprite, animation_tile(character->clip, character->step));
 	}
 	sprite_position(character->sprite, character->x, character->y);
 }
 
-/* Checks what tile the character is standing on:
-	1 - Loads map2.
-	2 - Loads map1 or boss fight.
+/*
+Entities are the other characters of a level, such as NPCs and enemies.
+They are kept as a structure of arrays packed into slots 0 to entity_count - 1,
+so each pass walks a few small arrays in IWRAM with no checks for empty slots.
 */
-unsigned short location_check(struct Character* character, int xscroll, int yscroll, unsigned short tracker)
-{
-	unsigned short action;
-	if (tracker == 1)
-	{
-		unsigned short tileCheck = tile_interact((character->x + 16), (character->y + 16), xscroll, yscroll, map1boundary, map1boundary_width, map1boundary_height, 49, 999, 149);
-		if (tileCheck == 0) action = 1;
-		else if (tileCheck == 1) action = 0;
-		else if (tileCheck == 3)
-		{	
-			setup_background(map2_data, map2_palette, map2_width, map2_height, map2tile, map2tile_width, map2tile_height);
-			setup_boundary(map2boundary, map2boundary_width, map2boundary_height);
-			action = 2;
-			sprite_clear();
-			character_init(character, 90,110, SIZE_16_16);
-		}
+#define MAX_ENTITIES 96
+
+/* Position in world pixels and movement per frame. */
+short entity_x[MAX_ENTITIES];
+short entity_y[MAX_ENTITIES];
+signed char entity_dx[MAX_ENTITIES];
+signed char entity_dy[MAX_ENTITIES];
+
+/* Frames left on the current leg of a patrol, and how long each leg lasts, 0 to stand still. */
+unsigned short entity_steps[MAX_ENTITIES];
+unsigned short entity_patrol[MAX_ENTITIES];
+
+/* Facing direction, the clips of the entity's sprite sheet, the clip playing and how far through it is. */
+unsigned char entity_direction[MAX_ENTITIES];
+const AnimationSet* entity_animations[MAX_ENTITIES];
+const struct AnimationClip* entity_clip[MAX_ENTITIES];
+unsigned char entity_step[MAX_ENTITIES];
+unsigned char entity_timer[MAX_ENTITIES];
+
+/* First tile of the entity in the sprite sheet, added to its clips, and its sprite. */
+unsigned short entity_tile[MAX_ENTITIES];
+struct Sprite* entity_sprite[MAX_ENTITIES];
+
+/*
+Entities move between slots when one despawns, so they are known by a handle.
+entity_handle gives the handle in a slot, entity_slot the slot of a handle.
+*/
+unsigned char entity_handle[MAX_ENTITIES];
+unsigned char entity_slot[MAX_ENTITIES];
+unsigned char entity_free_handles[MAX_ENTITIES];
+int entity_free_count = 0;
+int entity_count = 0;
+
+/* The movement of each direction. */
+const signed char direction_dx[4] = {0, -1, 0, 1};
+const signed char direction_dy[4] = {1, 0, -1, 0};
+
+/* Where an entity starts in a level. */
+struct Spawn
+{
+	short x, y;
+	unsigned char direction;
+	unsigned short patrol;
+	unsigned short tile;
+	const unsigned char* sheet;
+	const AnimationSet* animations;
+};
+
+/* Removes every entity, their sprites go with sprite_clear. */
+void entity_clear()
+{
+	entity_count = 0;
+	entity_free_count = MAX_ENTITIES;
+	for (int i = 0; i < MAX_ENTITIES; i++)
+	{
+		entity_free_handles[i] = MAX_ENTITIES - 1 - i;
+	}
+}
+
+/* Adds an entity and returns its handle, or -1 when there is no slot or sprite left. */
+int entity_spawn(const struct Spawn* spawn)
+{
+	if (entity_free_count == 0)
+	{
+		return -1;
+	}
+	struct Sprite* sprite = sprite_init_streamed(0, 0, SIZE_16_16, spawn->sheet, 0);
+	if (sprite == 0)
+	{
+		return -1;
+	}
+	sprite_hide(sprite, 1);
+
+	int handle = entity_free_handles[--entity_free_count];
+	int slot = entity_count++;
+	entity_handle[slot] = handle;
+	entity_slot[handle] = slot;
+
+	entity_x[slot] = spawn->x;
+	entity_y[slot] = spawn->y;
+	entity_direction[slot] = spawn->direction;
+	entity_patrol[slot] = spawn->patrol;
+	entity_steps[slot] = spawn->patrol;
+	entity_dx[slot] = spawn->patrol ? direction_dx[spawn->direction] : 0;
+	entity_dy[slot] = spawn->patrol ? direction_dy[spawn->direction] : 0;
+	entity_animations[slot] = spawn->animations;
+	entity_clip[slot] = &(*spawn->animations)[spawn->patrol ? ANIM_WALK : ANIM_STAND][spawn->direction];
+	entity_step[slot] = 0;
+	entity_timer[slot] = 0;
+	entity_tile[slot] = spawn->tile;
+	entity_sprite[slot] = sprite;
+	return handle;
+}
+
+/* Removes an entity, the last one moves into its slot so the tables stay packed. */
+void entity_despawn(int handle)
+{
+	int slot = entity_slot[handle];
+	int last = --entity_count;
+	sprite_free(entity_sprite[slot]);
+
+	entity_x[slot] = entity_x[last];
+	entity_y[slot] = entity_y[last];
+	entity_dx[slot] = entity_dx[last];
+	entity_dy[slot] = entity_dy[last];
+	entity_steps[slot] = entity_steps[last];
+	entity_patrol[slot] = entity_patrol[last];
+	entity_direction[slot] = entity_direction[last];
+	entity_animations[slot] = entity_animations[last];
+	entity_clip[slot] = entity_clip[last];
+	entity_step[slot] = entity_step[last];
+	entity_timer[slot] = entity_timer[last];
+	entity_tile[slot] = entity_tile[last];
+	entity_sprite[slot] = entity_sprite[last];
+	entity_handle[slot] = entity_handle[last];
+	entity_slot[entity_handle[slot]] = slot;
+
+	entity_free_handles[entity_free_count++] = handle;
+}
+
+/* Moves every entity, a patrolling one turns round at the end of each leg. */
+void entity_update_all()
+{
+	for (int i = 0; i < entity_count; i++)
+	{
+		entity_x[i] += entity_dx[i];
+		entity_y[i] += entity_dy[i];
 	}
-	else if (tracker == 2)
+	for (int i = 0; i < entity_count; i++)
 	{
-		unsigned short tileCheck = tile_interact((character->x + 16), (character->y + 16), xscroll, yscroll, map2boundary, map2boundary_width, map2boundary_height, 159, 999, 329);
-		if (tileCheck == 0) action = 1;
-		else if (tileCheck == 1) action = 0;
-		if (tileCheck == 2)
+		if (entity_patrol[i] && --entity_steps[i] == 0)
 		{
-			// TO DO.
+			entity_steps[i] = entity_patrol[i];
+			entity_dx[i] = -entity_dx[i];
+			entity_dy[i] = -entity_dy[i];
+			entity_direction[i] = (entity_direction[i] + 2) & 3;
+			entity_clip[i] = &(*entity_animations[i])[ANIM_WALK][entity_direction[i]];
+			entity_step[i] = 0;
+			entity_timer[i] = 0;
 		}
-		else if (tileCheck == 3)
-		{	
-			setup_background(map1_data, map1_palette, map1_width, map1_height, map1tile, map1tile_width, map1tile_height);
-			setup_boundary(map1boundary, map1boundary_width, map1boundary_height);
-			action = 2;
-			sprite_clear();
-			character_init(character, 90,110, SIZE_16_16);
+	}
+}
+
+/* Advances the clip of every entity. */
+void entity_animate_all()
+{
+	for (int i = 0; i < entity_count; i++)
+	{
+		animation_advance(entity_clip[i], &entity_step[i], &entity_timer[i]);
+	}
+}
+
+/*
+Places every entity's sprite relative to the scroll and hides those off screen.
+The world wraps, so an entity is drawn at its nearest copy.
+*/
+void entity_draw_all(int xscroll, int yscroll)
+{
+	int wrap_x = world_width * 8;
+	int wrap_y = world_height * 8;
+	for (int i = 0; i < entity_count; i++)
+	{
+		int x = wrap_tile(entity_x[i] - xscroll, wrap_x);
+		int y = wrap_tile(entity_y[i] - yscroll, wrap_y);
+		if (x > wrap_x - 16) x -= wrap_x;
+		if (y > wrap_y - 16) y -= wrap_y;
+
+		struct Sprite* sprite = entity_sprite[i];
+		if (x <= -16 || x >= WIDTH || y <= -16 || y >= HEIGHT)
+		{
+			sprite_hide(sprite, 1);
+			continue;
 		}
+		sprite_hide(sprite, 0);
+		sprite_position(sprite, x, y);
+		sprite_show_frame(sprite, entity_tile[i] + animation_tile(entity_clip[i], entity_step[i]));
 	}
-	return action;
 }
 
-/* Wait function. */
-void delay(unsigned int amount)
+/* Everything needed to load one map of the game. */
+struct Level
 {
-	for (int i = 0; i < amount * 10; i++);
+	/* Image and palette of the tiles. */
+	struct TileAsset background;
+
+	/* Visible and boundary layers with the collision of every tile. */
+	const struct MetatileMap* world;
+
+	/* Level a warp tile leads to. */
+	int warp_target;
+
+	/* Where the character starts and how the map is scrolled on arrival. */
+	int spawn_x, spawn_y, scroll_x, scroll_y;
+
+	/* The entities of the level. */
+	const struct Spawn* spawns;
+	int spawn_count;
+
+	/* The enemies met on an interact tile. */
+	struct Encounter encounter;
+};
+
+/* The people of each map, for now drawn with the hero's sheet. One walks back and forth, the other stands still. */
+const struct Spawn map1_spawns[] =
+{
+	{88, 80, DIRECTION_RIGHT, 32, 0, sprites_data, &hero_animations},
+	{120, 96, DIRECTION_DOWN, 0, 0, sprites_data, &hero_animations},
+};
+const struct Spawn map2_spawns[] =
+{
+	{96, 120, DIRECTION_DOWN, 40, 0, sprites_data, &hero_animations},
+};
+
+/* Every map of the game, a warp is an index into this table. */
+const struct Level levels[] =
+{
+	{
+		{map1_data, map1_width, map1_height, map1_palette, 0, 0, 0, 1, map1_bpp},
+		&map1meta,
+		1, 90, 110, 0, 0,
+		map1_spawns, sizeof(map1_spawns) / sizeof(map1_spawns[0]),
+		{2, {1, 2}}
+	},
+	{
+		{map2_data, map2_width, map2_height, map2_palette, 0, 0, 0, 1, map2_bpp},
+		&map2meta,
+		0, 90, 110, 0, 0,
+		map2_spawns, sizeof(map2_spawns) / sizeof(map2_spawns[0]),
+		{3, {3, 2, 4}}
+	},
+};
+
+/* Index of the level currently loaded. */
+int current_level = 0;
+
+/* Loads a level, places the character at its spawn point and sets the scroll. */
+void level_load(int index, struct Character* character, int* xscroll, int* yscroll)
+{
+	const struct Level* level = &levels[index];
+	current_level = index;
+	world = level->world;
+	world_width = world->width * METATILE_SIZE;
+	world_height = world->height * METATILE_SIZE;
+	*xscroll = level->scroll_x;
+	*yscroll = level->scroll_y;
+	setup_background(&level->background, *xscroll, *yscroll);
+	setup_boundary(&level->background, *xscroll, *yscroll);
+	sprite_clear();
+	character_init(character, level->spawn_x, level->spawn_y, SIZE_16_16);
+	entity_clear();
+	for (int i = 0; i < level->spawn_count; i++)
+	{
+		entity_spawn(&level->spawns[i]);
+	}
+}
+
+/* A battle starts on stepping onto an interact tile, not again until the character steps off it. */
+int interact_ready = 1;
+
+/* Checks what tile the character is standing on and returns what the main loop should do:
+	0 - On a boundary, only moves away from it are allowed.
+	1 - Free movement.
+	2 - Warped to a new level.
+	3 - A battle has started.
+*/
+unsigned short location_check(struct Character* character, int* xscroll, int* yscroll)
+{
+	unsigned short tileCheck = tile_interact((character->x + 16), (character->y + 16), *xscroll, *yscroll);
+	if (tileCheck != TILE_INTERACT) interact_ready = 1;
+	if (tileCheck == TILE_BLOCK) return 0;
+	else if (tileCheck == TILE_WARP)
+	{
+		level_load(levels[current_level].warp_target, character, xscroll, yscroll);
+		return 2;
+	}
+	else if (tileCheck == TILE_INTERACT && interact_ready)
+	{
+		interact_ready = 0;
+		character_stop(character);
+		battle_start(&levels[current_level].encounter);
+		return 3;
+	}
+	return 1;
 }
 
 /* Main function. */
 int main()
 {
+	interrupt_init();
+	timer_init();
 	*display_control = MODE0 | BG0_ENABLE | BG1_ENABLE | SPRITE_ENABLE | SPRITE_MAP_1D;
-	setup_background(map1_data, map1_palette, map1_width, map1_height, map1tile, map1tile_width, map1tile_height);
-	setup_boundary(map1boundary, map1boundary_width, map1boundary_height);
 	setup_sprite_image();
-	sprite_clear();
 
-	struct Character cainWorld;
-	character_init(&cainWorld, 90,110, SIZE_16_16);
+	struct Character cainWorld = {0};
+	int xscroll, yscroll;
+	level_load(0, &cainWorld, &xscroll, &yscroll);
+	battle_init(1);
 
-	int xscroll = 0;
-	int yscroll = 0;
 	unsigned short action = 1;
-	unsigned short mapTracker = 1;
-	unsigned short move;
+	unsigned short move = 4;
 
 	while (1)
 	{
-		character_update(&cainWorld);
-		if (action == 0)
+		input_update();
+		if (action == 3)
 		{
-			if (mapTracker == 1)
-			{
-				move = move_collision(&cainWorld, xscroll, yscroll, map1boundary, map1boundary_width, map1boundary_height, 149);
-			}
-			else if (mapTracker == 2)
+			/* In a battle the map is left as it is until the battle ends. */
+			enum BattleResult result = battle_update();
+			if (result != BATTLE_RUNNING)
 			{
-				move = move_collision(&cainWorld, xscroll, yscroll, map2boundary, map2boundary_width, map2boundary_height, 329);
+				battle_end();
+				action = 1;
+				if (result == BATTLE_LOST)
+				{
+					/* Losing sends the character back to the start, healed. */
+					level_load(0, &cainWorld, &xscroll, &yscroll);
+					battle_heal();
+				}
 			}
+			frame_wait(1);
+			continue;
+		}
+		character_update(&cainWorld);
+		if (action == 0)
+		{
+			move = move_collision(&cainWorld, xscroll, yscroll);
 		}
-		action = location_check(&cainWorld, xscroll, yscroll, mapTracker);
-		if (action == 3 && mapTracker == 1) mapTracker = 2;
-		else if (action == 3 && mapTracker == 2) mapTracker = 1;
-		if ((button_pressed(BUTTON_DOWN) && action == 1) || (button_pressed(BUTTON_DOWN) && (move != 0)))
+		action = location_check(&cainWorld, &xscroll, &yscroll);
+		if (action == 3)
+		{
+			frame_wait(1);
+			continue;
+		}
+		if ((key_held(BUTTON_DOWN) && action == 1) || (key_held(BUTTON_DOWN) && (move != 0)))
 		{
 			if (character_down(&cainWorld))
 			{
 				yscroll++;
 			}
 		}
-		else if ((button_pressed(BUTTON_UP) && action == 1) || (button_pressed(BUTTON_UP) && (move != 2)))
+		else if ((key_held(BUTTON_UP) && action == 1) || (key_held(BUTTON_UP) && (move != 2)))
 		{
 			if (character_up(&cainWorld))
 			{
 				yscroll--;
 			}
 		}
-		else if ((button_pressed(BUTTON_RIGHT) && action == 1) || (button_pressed(BUTTON_RIGHT) && (move != 3)))
+		else if ((key_held(BUTTON_RIGHT) && action == 1) || (key_held(BUTTON_RIGHT) && (move != 3)))
 		{
 			if (character_right(&cainWorld))
 			{
 				xscroll++;
 			}
 		}
-		else if ((button_pressed(BUTTON_LEFT) && action == 1) || (button_pressed(BUTTON_LEFT) && (move != 1)))
+		else if ((key_held(BUTTON_LEFT) && action == 1) || (key_held(BUTTON_LEFT) && (move != 1)))
 		{
 			if (character_left(&cainWorld))
 			{
@@ -594,41 +1017,24 @@ int main()
 		{
 			character_stop(&cainWorld);
 		}
-		wait_vblank();
+		entity_update_all();
+		entity_animate_all();
+		entity_draw_all(xscroll, yscroll);
+		stream_scroll(&background_stream, xscroll, yscroll);
+		stream_scroll(&boundary_stream, xscroll, yscroll);
+		frame_wait(1);
+		/* The hardware only uses the low 9 bits, which line up with the streamed screen blocks. */
 		*bg0_x_scroll = xscroll;
 		*bg0_y_scroll = yscroll;
 		*bg1_x_scroll = xscroll;
 		*bg1_y_scroll = yscroll;
+		stream_commit(&background_stream);
+		stream_commit(&boundary_stream);
+		sprite_stream_commit();
 		sprite_update_all();
-		delay(500);
 	}
 }
 
-void interrupt_ignore() 
-{
-    /* do nothing */
-}
-
-
-/* this table specifies which interrupts we handle which way
- * for now, we ignore all of them */
-typedef void (*intrp)();
-const intrp IntrTable[13] = {
-    interrupt_ignore,   /* V Blank interrupt */
-    interrupt_ignore,   /* H Blank interrupt */
-    interrupt_ignore,   /* V Counter interrupt */
-    interrupt_ignore,   /* Timer 0 interrupt */
-    interrupt_ignore,   /* Timer 1 interrupt */
-    interrupt_ignore,   /* Timer 2 interrupt */
-    interrupt_ignore,   /* Timer 3 interrupt */
-    interrupt_ignore,   /* Serial communication interrupt */
-    interrupt_ignore,   /* DMA 0 interrupt */
-    interrupt_ignore,   /* DMA 1 interrupt */
-    interrupt_ignore,   /* DMA 2 interrupt */
-    interrupt_ignore,   /* DMA 3 interrupt */
-    interrupt_ignore,   /* Key interrupt */
-};
-
 /*
 TO DO:
 ~ Put all .h into structs so it can be passed as an argument into functions to make things simpler.
@@ -641,8 +1047,8 @@ TO DO:
 ~ Sprite movement. (done)
 ~ Sprite direction. (done)
 ~ Sprite collision. (done)
-~ Battle map.
-~ Fight menu.
+~ Battle map. (done)
+~ Fight menu. (done)
 ~ Convert 3 functions into assembly.
 ~ Smooth screen (map) transition.
 */
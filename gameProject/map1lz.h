@@ -0,0 +1,234 @@
+/* map1.h
+ * packed by tilegen from map1.h */
+
+#define map1_width 8
+#define map1_height 720
+#define map1_bpp 8
+
+/* LZ77 compressed by gbacomp, 5760 bytes down to 4036 */
+const unsigned int map1_data [] = {
+    0x00168010, 0xf001013e, 0xf001f001, 0xa001f001, 0x20890201, 0x05040305,
+    0x07060d30, 0x04290720, 0x091d4008, 0x0a080730, 0x10801520, 0x01020702,
+    0x03020203, 0x03060100, 0x03060b06, 0x0008400b, 0x030c0a07, 0x000d0a05,
+    0x08020801, 0x0602040d, 0x0e050101, 0x07040908, 0x0c082100, 0x00040904,
+    0x04060a29, 0x20080532, 0x04403067, 0x05400004, 0x08060410, 0x0b084000,
+    0x08000f03, 0x1009100f, 0x02110806, 0x08080802, 0x1a101106, 0x08030007,
+    0x05010206, 0x010e070a, 0x20030603, 0x70020003, 0x022004b2, 0x04810008,
+    0x0906080a, 0x09030600, 0x10031008, 0x0d09000f, 0x0711010e, 0x08040308,
+    0x02010c05, 0x12039f10, 0x00b500c4, 0x021203cd, 0x010ad500, 0x3d500659,
+    0x10840003, 0x300a0901, 0x0b0b04fa, 0x000b0808, 0x2103110a, 0x64101301,
+    0x0b010908, 0x0e082310, 0x20150114, 0x0f011074, 0xf01f10e9, 0x04d01001,
+    0x0e034d30, 0x00932011, 0x000b0582, 0x00030614, 0x42a8204c, 0x056d2007,
+    0xe00e040c, 0x02120241, 0x1c000804, 0x40010602, 0x26018003, 0x110a060b,
+    0x080a0a0b, 0x06040309, 0x030b1a00, 0x0b010b06, 0x4d010708, 0x013c0111,
+    0x47108855, 0x110d0304, 0x0b080497, 0x01070500, 0x0a010204, 0x07030105,
+    0x0a070a01, 0x00f70003, 0x09110901, 0x0e050708, 0x0b010416, 0x0006eb00,
+    0x0438011e, 0x2c000367, 0x02040500, 0x4701b401, 0x041c4100, 0xee000107,
+    0xf6101220, 0x0405040a, 0x0e100e02, 0x00018d00, 0x6800c407, 0x0608d100,
+    0x04570004, 0x07092204, 0x01013710, 0x082a0016, 0x02050222, 0x12010f04,
+    0x05049100, 0x09011707, 0x13501107, 0x06403501, 0x0e188800, 0x04071103,
+    0x10040702, 0x00110206, 0x09210333, 0x04261003, 0x000e120b, 0x04010036,
+    0x0303060f, 0x05000c08, 0x0b0a0201, 0x810c090e, 0x0f023800, 0x0b0e090e,
+    0x14410b02, 0x02099300, 0x010b0119, 0x020748ee, 0x12100919, 0x11030221,
+    0x98120646, 0x000b0604, 0x10ab11b5, 0x00070824, 0x020b0a27, 0x5012049d,
+    0x0a260108, 0x0903e101, 0x08000917, 0x0c0e1102, 0x20101805, 0x38020b06,
+    0x080f0f04, 0x01114018, 0x030f0d75, 0x800e0a0f, 0x0410ca01, 0x0105030d,
+    0x0b0b0e03, 0x7fd10d01, 0x01107c11, 0x0006600a, 0x0f07125b, 0x0c010309,
+    0x10010400, 0x140a100f, 0x0102060f, 0x021a0617, 0x110700df, 0x13091508,
+    0x022c1009, 0x0431080a, 0x0080010e, 0x0e0e02db, 0x0878f511, 0x4a100800,
+    0xa600bc00, 0x380a0304, 0x1f100701, 0x79015902, 0x70110201, 0x30040108,
+    0x0254011f, 0x07020308, 0x05030307, 0x010f0003, 0xc0f900d8, 0x4001c502,
+    0x080e010b, 0x11200402, 0x070f0108, 0x0e060402, 0x37020f41, 0x05050e08,
+    0xc09c0106, 0x0403c200, 0x0e010407, 0x00830a12, 0x0702023c, 0xb9110b04,
+    0x0a410900, 0x0603c301, 0x110a0702, 0x07060a70, 0xe2010503, 0x04b90107,
+    0x05010a0c, 0x00f30008, 0x36020807, 0x4e020e0b, 0x010b4a01, 0x05c7015d,
+    0x8712084c, 0x2b010305, 0x03030700, 0x11a000cc, 0x000606e8, 0x09a900c8,
+    0xb010840a, 0x03100102, 0x0102cd10, 0x000e0f33, 0x0bef03ff, 0x00220103,
+    0x0b101030, 0x01db0306, 0x3f050c01, 0xb3000809, 0xed103402, 0x07c00a53,
+    0x14b001d0, 0xef010a60, 0x0e01a700, 0x0a611011, 0x4901c300, 0x10040610,
+    0x06106c00, 0x09010516, 0x17060102, 0xc5000840, 0x1a090103, 0x0e580103,
+    0x001a4214, 0x0c7c040f, 0x0080081a, 0x0a0d0305, 0x0a0e0908, 0x18080204,
+    0x51020502, 0x18000202, 0x03031802, 0x10070302, 0x001a020b, 0x0605032c,
+    0x011b6602, 0x05e60078, 0x14780215, 0x04401563, 0x0207a401, 0x1401150b,
+    0x0b131100, 0x01080b0f, 0x17110010, 0x08160505, 0x03c40a01, 0x057b03f8,
+    0x7a03170c, 0x05100918, 0x8b041a0a, 0x06050f18, 0x91041760, 0x14090400,
+    0x20021a02, 0x26001706, 0x03081405, 0x1735f617, 0x070038e5, 0x010a2a45,
+    0x0f13108c, 0x06180b12, 0x0f09eb10, 0x07063f02, 0x13030515, 0x239e0206,
+    0x9e8a00bf, 0x0c02ce12, 0x07102c04, 0x32101410, 0x9344bd0a, 0x10281207,
+    0x22c30227, 0x51200c6f, 0x12060228, 0x15020628, 0x310e0108, 0x06000b09,
+    0x0505cb13, 0x218b0103, 0x3d04030e, 0x0e02020e, 0x03427e00, 0x060ebe03,
+    0x91000b02, 0x0b020d04, 0x07101008, 0x110f6505, 0xd005a9f3, 0x09e20109,
+    0x050ab002, 0x01820700, 0x020908dd, 0x0e041208, 0x01111a07, 0x13681003,
+    0x2b000cba, 0x6100c708, 0x0a015200, 0x0021021c, 0x000c0233, 0x0c040312,
+    0x09010e07, 0x17140c5c, 0x008c0508, 0x08800571, 0x000e6a0a, 0x06240008,
+    0x04025702, 0x020f1136, 0x0307020e, 0x148602d8, 0x018b01bb, 0x0c1d1108,
+    0x05060c03, 0x3a8188a8, 0x131e0e0e, 0x0c0e0e3f, 0x0c120c10, 0x0e1e1570,
+    0x0c001d1d, 0x0c0c1e1d, 0x2512060c, 0x06100b12, 0x2e041f0c, 0x0005000c,
+    0x01090612, 0x0106080c, 0x0c1a0e02, 0x0203121e, 0x00a118f2, 0x37050a94,
+    0x20010618, 0x04004406, 0x211d0b0b, 0x000f040b, 0x0b0b060e, 0x1704090d,
+    0x0b1b0484, 0x02020612, 0x431208c8, 0x0b410012, 0x010e0c12, 0xf2071234,
+    0x1d008802, 0x25050700, 0x07200a08, 0x05031a0a, 0x00b00113, 0x7f040317,
+    0x0e020814, 0xf7060a1c, 0x44020918, 0x09b60005, 0xdd061212, 0x02c0010b,
+    0x1a4e0019, 0x06021804, 0x05031014, 0x0660010f, 0x02090309, 0x0a110812,
+    0x6800110a, 0x0011410b, 0x040b07e4, 0x09100917, 0x1a010b0c, 0x02d00509,
+    0x10061508, 0x020a0f0b, 0x150c1519, 0x10150005, 0x0a021010, 0x1b000315,
+    0x03101a0b, 0x11051808, 0x000a0613, 0x0b090a52, 0x03000300, 0x0c1a020a,
+    0x800f0906, 0x02150b02, 0x0f1a0311, 0x15080003, 0x08060f02, 0x0627071a,
+    0x0ecf001a, 0x4451f31a, 0xd88842c7, 0x0700c644, 0x02a50103, 0x0f10092f,
+    0x04050500, 0x140a0601, 0xea02b918, 0x04571214, 0x08ad2680, 0xfeae1602,
+    0x2e043e04, 0xcc01af24, 0xe8276732, 0xbb111d14, 0x0503b213, 0x021f1091,
+    0x25060b06, 0x041e9512, 0xbe040d02, 0x4b03f916, 0xc207cf02, 0xcc029a17,
+    0x060a040c, 0xd5090710, 0x07008c04, 0x05020602, 0x050e5a01, 0x04035fa1,
+    0x38060240, 0x2a026004, 0xd9063d05, 0x003802c1, 0x12080661, 0x8506040e,
+    0x12410890, 0x08350501, 0x800b100c, 0x2222a501, 0x011f090c, 0x100e1108,
+    0x0ec4010b, 0x1602091d, 0x0f060902, 0x00100909, 0x01920910, 0x001210cc,
+    0x01090b11, 0x06111d70, 0xa0010912, 0x08120b0e, 0x0c232641, 0x0c090a00,
+    0x4002f901, 0x1212080c, 0x4e000c12, 0x0012060b, 0x0c0b0b0b, 0x101d1d1d,
+    0x0b090b00, 0x0c0d0b10, 0x091f151d, 0x120e0210, 0x061f4000, 0x121f158f,
+    0x0940000b, 0x00125d00, 0x0c090d40, 0x10000c0b, 0x020b3112, 0x000c66b4,
+    0x1f40203b, 0x0519001d, 0x040009b3, 0x0c1d1f0c, 0x43101607, 0x0c161004,
+    0x00071010, 0x60071086, 0x03400003, 0x0c03101f, 0x06191f12, 0x7f120c10,
+    0x1d064020, 0x10888800, 0x18090345, 0x15030509, 0x17090904, 0x07000707,
+    0xab040a01, 0x0f000344, 0x06041406, 0x280415ce, 0x4201100b, 0x12070004,
+    0x05100302, 0x57031704, 0x07050305, 0x1f121010, 0x03056a02, 0x09010410,
+    0x031a020f, 0x64071a02, 0x08180310, 0x030f2700, 0x10f91707, 0x051d000f,
+    0x0244004d, 0x1006036f, 0x06093444, 0xd505a005, 0x0494000f, 0x070a5001,
+    0xec020b3d, 0x100b1b02, 0x0f060f08, 0x18920207, 0x1000061a, 0x05150407,
+    0x01171617, 0x1308020f, 0x000b170a, 0x000a4023, 0x1a0a06c8, 0x00021009,
+    0x090a1218, 0x010d0b06, 0x020a1521, 0x010d173b, 0xff04051a, 0x3f491107,
+    0xd85307c0, 0x0429e124, 0x30550730, 0x02f873dc, 0x37370e01, 0x16109e01,
+    0x0c310807, 0x025f020c, 0x1d0c0c87, 0x0a080700, 0x090c1f03, 0x0e0906be,
+    0x1e1e0c00, 0x070b0602, 0x061f0803, 0xea050e06, 0x6e0c2402, 0x014e191e,
+    0x61161f7b, 0x37242f00, 0x3304ca0c, 0x1f0c0f10, 0x00044f10, 0x1e001d37,
+    0x09070201, 0x5a09061f, 0x08560012, 0x66004710, 0x122f0206, 0x010202c0,
+    0x1e061686, 0x890d101f, 0x0606ed01, 0x1daf010c, 0x8083041d, 0x09126a04,
+    0x06060e0b, 0x09093724, 0x5a020b00, 0x01140206, 0x484600df, 0x1d0b0206,
+    0x125e080c, 0x0c10090c, 0x4f020923, 0x0d12060f, 0x2f00104a, 0x4d020612,
+    0x09580006, 0x018302d4, 0x010009e4, 0x0b62021e, 0x021e7c06, 0x107e0287,
+    0x04b7020a, 0xe0230cfc, 0xae023010, 0x10037302, 0x1d0c1f0b, 0x020a111e,
+    0x04180292, 0x04001d42, 0x0c041f60, 0x1206f104, 0x43031403, 0x107a1212,
+    0x001d0414, 0x23e20430, 0xb7020608, 0x08101a12, 0x032a0a30, 0x03010e09,
+    0xee090b0a, 0x07fd871b, 0xf77187b4, 0x1301b077, 0x14a2064b, 0x12504d00,
+    0x030f3f0a, 0x08120e11, 0x10186a05, 0x1a8e01a8, 0x00231301, 0x00831782,
+    0x0c0b10b9, 0x73151708, 0x0794b400, 0x00120b1c, 0x28090ca3, 0x0b260818,
+    0x0a0f0608, 0x0aea161b, 0x05831343, 0x040707e5, 0x91061508, 0x0210d208,
+    0x9a05071b, 0x1a080703, 0x09030413, 0x14036f02, 0x54046114, 0x0a020b00,
+    0x09150205, 0x05180003, 0x150f0314, 0x0788060c, 0x15181151, 0x1a056601,
+    0x000b6207, 0x0bfa0407, 0x03051518, 0x0a0f0607, 0x0c0c1710, 0x17870250,
+    0x00030cc8, 0x040b0b7d, 0x10070f50, 0x580b0f7b, 0x764777a7, 0x411167e2,
+    0x88afd208, 0x05084e1a, 0x03160a0b, 0x03b70509, 0x5c0007fb, 0x0907e924,
+    0x04b40021, 0x0c057fe9, 0x00d40672, 0x09cb0432, 0x09323ba7, 0x2b07a7a7,
+    0x0164080e, 0x038c020a, 0x88711c5e, 0x05025903, 0x0b620c11, 0x09680704,
+    0xf20c3409, 0x02020002, 0x07150a03, 0xe5040502, 0x03e41c07, 0x1bfc490c,
+    0x08db0c6a, 0x02fc09b1, 0x0e9d0519, 0x230c0703, 0x0208081e, 0x275b02a0,
+    0x2802c14a, 0x0e02e307, 0x190c061d, 0x03056172, 0x03df0107, 0x090e1f0e,
+    0xe60bb2c0, 0x0a1f0506, 0x071d061e, 0x041e0107, 0x1b072311, 0x3d070101,
+    0x13050713, 0x131d0c03, 0x000a0457, 0x0f27000f, 0x1d1e0302, 0x5a1c0703,
+    0x27000305, 0x0703035b, 0x128f141d, 0x37151d90, 0x0b47e204, 0x23062503,
+    0x02c4041f, 0xc8fc0a19, 0x8f020f02, 0xac040a06, 0xd0110a12, 0xfc04bf04,
+    0x12740a16, 0x7f0b1609, 0x156f0217, 0x03e2027b, 0x02b70232, 0x004e0219,
+    0x0e050e14, 0x0716061f, 0x01110a3f, 0x004506bb, 0x1bf600f2, 0xcd0300c0,
+    0xc7028fd2, 0x6e04120b, 0x160c7403, 0x1005df9a, 0x010e0e0c, 0x21fb066a,
+    0x206d3c9d, 0xbef2a43c, 0x06bc0001, 0x064f0d05, 0x0f101106, 0x0924000a,
+    0xf2211a0b, 0x22bf00ce, 0x0a181f0a, 0x4e0f103b, 0x0a1612c2, 0x48100b18,
+    0x20d0041d, 0x0c4a0c3f, 0x0303e203, 0x071fb503, 0x03c80298, 0x050601e0,
+    0x1e4c1602, 0x036f030b, 0x0b019500, 0x008f1312, 0x088a0752, 0xff12d07a,
+    0x05098f33, 0x0f0b0e58, 0x101a3c01, 0x1a0a3005, 0xf008c100, 0x1011031a,
+    0x860b181a, 0x000a0a18, 0x0204020b, 0x1a06061a, 0x0c04a305, 0x0f0c0617,
+    0x950a8308, 0x03131804, 0xa4050e06, 0x603f1406, 0x52ffa772, 0x4ec7f297,
+    0x1ac7c29f, 0x175002d8, 0x36e60937, 0x040a0e0b, 0x030dcc09, 0x026b012d,
+    0xd602067b, 0x491eba0d, 0x070b0915, 0x39520dc9, 0x0c081601, 0xf20be81c,
+    0x510f0c01, 0x1300116e, 0x0805640c, 0x02801e01, 0x18b10ea6, 0x321f1036,
+    0x010b0700, 0x97830f0a, 0x08122e1c, 0x000b2a1c, 0x0a181085, 0x031e8221,
+    0x0c1e0206, 0x0334001e, 0x091f080d, 0x02af011f, 0x77002357, 0x2d06024c,
+    0x28000c0c, 0x0c1ddb07, 0x06310a9c, 0x09b5090e, 0x230f00a4, 0x0706011d,
+    0x1d010902, 0xe7b7050c, 0x7e025200, 0x1109ee0a, 0x6618120a, 0x02dc9d00,
+    0x16a922a7, 0x56d6e440, 0x0c12666b, 0x1b200f4d, 0xfe011406, 0x0310cf21,
+    0x27019d0b, 0x0f201a0b, 0x0742310f, 0x3ccf3d1a, 0xc3180f09, 0x56326b18,
+    0x03081712, 0xdc0a1172, 0x69072f01, 0x49160a11, 0x0c033f06, 0x3d003301,
+    0xfa2c1301, 0xe7080201, 0x030c0933, 0x06f20ac5, 0x0115090c, 0x630ffd7a,
+    0x210ba101, 0xb2080730, 0x0d015c0b, 0x09107f3f, 0x03631f39, 0x045600e9,
+    0x1786294b, 0x2a0bf8d9, 0xdf037214, 0x7802b906, 0x6b1c0e07, 0x03d7030e,
+    0x070011df, 0x0cee0309, 0x010c7ad7, 0x019f032f, 0x02c21b3f, 0x0004d703,
+    0x2302090e, 0x010c1f12, 0x020b0e02, 0x01231e1d, 0x02670b37, 0xeb203600,
+    0xa30e110e, 0xaa006c2c, 0xf02bf3f0, 0x05018001, 0x0a080b53, 0x1e097f03,
+    0x12970046, 0x47e2193d, 0xf23c4aae, 0x0160c19e, 0x120bfb16, 0x0f101105,
+    0x1e1d00d5, 0x0d120307, 0x1278120e, 0xc50bf800, 0x29013d03, 0x4f040a0b,
+    0x036f0a0b, 0x00fe0f08, 0x96601e55, 0x7d10cf9a, 0x0e05c103, 0xb31e1701,
+    0x01f0bef0, 0x00ffa3cd, 0x0b110540, 0x05931c4a, 0xf0fb5411, 0x7001f040,
+    0x17190a01, 0xc507179d, 0x0bc7b119, 0x0cd000a4, 0x77071817, 0xe217f117,
+    0x03150591, 0x1d642a17, 0x1704100b, 0x0c9d0199, 0x05420510, 0x530f1446,
+    0xaff3fea7, 0x27f9aff3, 0x0f1d7c2b, 0xc603cb05, 0xa503ea08, 0x322df005,
+    0x08323d11, 0x18026b05, 0x0205040b, 0x03250931, 0x04c10423, 0x1f2e0680,
+    0x230c0404, 0x0bcc8708, 0x016a0330, 0x02430a0a, 0xa20e227c, 0x03084e02,
+    0x0405019f, 0xef0bd80c, 0xb71d4402, 0x06122500, 0x0b67065c, 0x8f751840,
+    0x2323b904, 0x13d10a1e, 0x0743082b, 0xc100c1fb, 0x0c1dea0a, 0x041e1e01,
+    0x17166cee, 0x1fa92aed, 0xf3081f09, 0x01ff0d09, 0x0b5806e5, 0x10d60a1f,
+    0x1818061a, 0x826f1613, 0x0401cb18, 0x191d2305, 0x0a530757, 0x07124d06,
+    0x00010e20, 0xc68f190e, 0xa6174313, 0x08050902, 0x04f811a8, 0x3f7704ff,
+    0xfb8a0afd, 0x00a71ba7, 0x00a7ab0b, 0x01234b7b, 0x000f0ba7, 0x13001073,
+    0x29c7ac01, 0x121f00a8, 0xa72b2312, 0x9505aa05, 0x01a7fbdd, 0xe8091fdf,
+    0xc208bc10, 0x0fde050f, 0x230b0910, 0xc700dc09, 0x4000f616, 0x1b3400f3,
+    0x0b0600a7, 0x06161fa7, 0xff4040ce, 0x2d011707, 0xf705b51b, 0x4000a200,
+    0x39000801, 0x091727fc, 0x00690083, 0x1a5300b3, 0x7f1f102c, 0x00500023,
+    0x16480a83, 0x1a3b00d7, 0xc30a0a27, 0x8a008800, 0x0b1d121f, 0xc400641a,
+    0x06642adb, 0x69000653, 0x01103200, 0x7e1a1a99, 0x03221a1a, 0x10f90339,
+    0x00a31dfc, 0x0b220928, 0x12fc200f, 0xfc200f03, 0x18162f0c, 0x0223fc20,
+    0x564742a1, 0xe767fb47, 0x38c5e749, 0x00007f52, 0x01f001f0, 0x508001f0,
+    0x00000001,
+};
+
+const unsigned short map1_palette [] = {
+    0x7c1f, 0x0000, 0x1080, 0x2524, 0x1000, 0x3524, 0x35a9, 0x2480, 0x2484,
+    0x49ad, 0x3529, 0x4a4d, 0x2529, 0x4a52, 0x1084, 0x5ad2, 0x5a52, 0x49a9,
+    0x35ad, 0x7f7b, 0x5ad6, 0x7fff, 0x5a4d, 0x6f76, 0x6ed6, 0x2520, 0x6f7b,
+    0x7ffb, 0x35a4, 0x1129, 0x0084, 0x25a9, 0x3652, 0x35b2, 0x0004, 0x1124,
+    0x1089, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+};
+
+/* The tile map entry of each tile of the original image, for metagen -r. */
+#ifdef TILEGEN_REMAP
+const unsigned short map1_remap [] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0007, 0x0008,
+    0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x000e, 0x000f, 0x0010, 0x0011, 0x0012, 0x0013,
+    0x0014, 0x0015, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0017, 0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0022, 0x0023,
+    0x0000, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x002b, 0x0000, 0x002c,
+    0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0000,
+    0x0000, 0x0035, 0x0036, 0x0037, 0x0000, 0x0038, 0x0039, 0x003a, 0x003b,
+    0x0000, 0x003c, 0x003d, 0x003e, 0x003f, 0x0000, 0x0000, 0x0040, 0x0041,
+    0x0042, 0x0000, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0044, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0045, 0x0046, 0x0047, 0x0000, 0x0000,
+    0x0000, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x0000,
+    0x0000, 0x004f, 0x0050, 0x0051, 0x0052, 0x0000, 0x0000, 0x0053, 0x0054,
+    0x0055, 0x0000, 0x0056, 0x0057, 0x0058, 0x0059,
+};
+#endif
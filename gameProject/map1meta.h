@@ -0,0 +1,79 @@
+/* created by metagen from map1tile.h and map1boundary.h */
+
+#define map1meta_width 16
+#define map1meta_height 16
+#define map1meta_count 43
+
+const struct Metatile map1meta_metatiles [] = {
+    {{{0x0000, 0x0000, 0x0000, 0x0000}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x0000, 0x0000, 0x0000, 0x0006}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x0000, 0x0001, 0x0007, 0x0008}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x0002, 0x0003, 0x0009, 0x000a}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x0004, 0x0005, 0x000b, 0x000c}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x0000, 0x0000, 0x000d, 0x0000}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x0000, 0x000e, 0x0000, 0x0017}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x000f, 0x0010, 0x0018, 0x0019}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x0011, 0x0012, 0x001a, 0x001b}, {0x0059, 0x0012, 0x0059, 0x001b}}},
+    {{{0x0013, 0x0014, 0x001c, 0x001d}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x0015, 0x0016, 0x001e, 0x001f}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x0000, 0x0000, 0x0020, 0x0000}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x0000, 0x0021, 0x0000, 0x002b}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x0022, 0x0023, 0x0024, 0x0054}, {0x0059, 0x0059, 0x0024, 0x0054}}},
+    {{{0x0054, 0x0024, 0x0024, 0x0054}, {0x0054, 0x0024, 0x0024, 0x0054}}},
+    {{{0x0054, 0x0026, 0x0024, 0x0054}, {0x0054, 0x0026, 0x0024, 0x0054}}},
+    {{{0x0027, 0x0028, 0x0031, 0x0032}, {0x0059, 0x0059, 0x0031, 0x0059}}},
+    {{{0x0029, 0x002a, 0x0033, 0x0034}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x0000, 0x0035, 0x0000, 0x0040}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x0036, 0x0037, 0x0041, 0x0042}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x0024, 0x0024, 0x0024, 0x0054}, {0x0024, 0x0024, 0x0024, 0x0054}}},
+    {{{0x0031, 0x0032, 0x0025, 0x003d}, {0x0031, 0x0059, 0x0025, 0x003d}}},
+    {{{0x0033, 0x0034, 0x003e, 0x003f}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x0000, 0x0045, 0x0000, 0x004f}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x0046, 0x0047, 0x0050, 0x0051}, {0x0059, 0x0059, 0x0059, 0x0051}}},
+    {{{0x0054, 0x0024, 0x0024, 0x0024}, {0x0054, 0x0024, 0x0024, 0x0024}}},
+    {{{0x0054, 0x0024, 0x0024, 0x0055}, {0x0054, 0x0024, 0x0024, 0x0055}}},
+    {{{0x0054, 0x0024, 0x0053, 0x0056}, {0x0054, 0x0024, 0x0053, 0x0056}}},
+    {{{0x004d, 0x004e, 0x0057, 0x0058}, {0x004d, 0x0059, 0x0057, 0x0059}}},
+    {{{0x0000, 0x002c, 0x0000, 0x0038}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x002d, 0x0055, 0x002d, 0x002e}, {0x002d, 0x0055, 0x002d, 0x002e}}},
+    {{{0x0024, 0x0055, 0x002e, 0x002e}, {0x0024, 0x0055, 0x002e, 0x002e}}},
+    {{{0x0024, 0x0055, 0x002e, 0x002f}, {0x0024, 0x0055, 0x002e, 0x002f}}},
+    {{{0x004d, 0x0058, 0x0030, 0x0000}, {0x004d, 0x0059, 0x0059, 0x0059}}},
+    {{{0x0000, 0x0043, 0x0000, 0x0000}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x002d, 0x002e, 0x0052, 0x0024}, {0x002d, 0x002e, 0x0059, 0x0024}}},
+    {{{0x002e, 0x002e, 0x0024, 0x0024}, {0x002e, 0x002e, 0x0024, 0x0024}}},
+    {{{0x002e, 0x0039, 0x0024, 0x003c}, {0x002e, 0x0039, 0x0024, 0x0059}}},
+    {{{0x003a, 0x003a, 0x0000, 0x0000}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x003a, 0x003b, 0x0000, 0x0000}, {0x0059, 0x0059, 0x0059, 0x0059}}},
+    {{{0x002c, 0x0055, 0x0048, 0x0049}, {0x0059, 0x0055, 0x0059, 0x0059}}},
+    {{{0x0055, 0x0055, 0x004a, 0x004b}, {0x0055, 0x0055, 0x004a, 0x0059}}},
+    {{{0x0055, 0x0044, 0x004c, 0x0000}, {0x0055, 0x0059, 0x0059, 0x0059}}},
+};
+
+const unsigned char map1meta_collision [] = {
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xd1, 0x55, 0x55, 0x55,
+    0x55, 0x05, 0x00, 0x00, 0x45, 0x55, 0x55, 0x55, 0x00, 0x04, 0x55, 0x55,
+    0x15, 0x00, 0x00, 0x00, 0x44, 0x55, 0x00, 0x00, 0x00, 0x54, 0x55, 0x10,
+    0x00, 0x40, 0x55, 0x55, 0x51, 0x60, 0x54,
+};
+
+const unsigned char map1meta_map [] = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   1,   2,   3,   4,   5,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   6,   7,   8,   9,  10,  11,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,  12,  13,  14,  15,  16,  17,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,  18,  19,  20,  14,  14,  21,  22,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,  23,  24,  20,  25,  26,  27,  28,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,  29,  30,  31,  31,  31,  32,  33,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,  34,  35,  36,  37,  38,  39,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,  40,  41,  42,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+const struct MetatileMap map1meta = {map1meta_metatiles, map1meta_collision, map1meta_map, 16, 16};
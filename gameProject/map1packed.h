@@ -0,0 +1,544 @@
+/* map1.h
+ * packed by tilegen from map1.h */
+
+#define map1_width 8
+#define map1_height 720
+#define map1_bpp 8
+
+const unsigned char map1_data [] = {
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x04, 0x05,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x06, 0x07, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x04, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x09, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x04,
+    0x01, 0x01, 0x04, 0x01, 0x07, 0x02, 0x01, 0x03, 0x02, 0x02, 0x03, 0x01,
+    0x06, 0x03, 0x06, 0x0b, 0x06, 0x03, 0x0b, 0x08, 0x06, 0x03, 0x06, 0x0a,
+    0x0c, 0x03, 0x05, 0x0a, 0x0d, 0x01, 0x08, 0x02, 0x08, 0x0d, 0x04, 0x02,
+    0x06, 0x01, 0x05, 0x0e, 0x08, 0x09, 0x04, 0x07, 0x03, 0x01, 0x06, 0x0c,
+    0x04, 0x09, 0x04, 0x02, 0x03, 0x01, 0x0a, 0x06, 0x04, 0x05, 0x08, 0x02,
+    0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 0x01, 0x07, 0x04, 0x04,
+    0x03, 0x02, 0x02, 0x05, 0x04, 0x06, 0x08, 0x06, 0x0b, 0x06, 0x08, 0x0b,
+    0x03, 0x0f, 0x08, 0x0f, 0x10, 0x09, 0x10, 0x06, 0x08, 0x11, 0x02, 0x08,
+    0x08, 0x08, 0x06, 0x11, 0x02, 0x02, 0x05, 0x04, 0x07, 0x03, 0x08, 0x06,
+    0x02, 0x01, 0x05, 0x0a, 0x07, 0x01, 0x03, 0x06, 0x03, 0x01, 0x03, 0x06,
+    0x03, 0x01, 0x06, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x04, 0x02, 0x08, 0x02, 0x02, 0x03, 0x04, 0x0a, 0x08,
+    0x06, 0x09, 0x06, 0x03, 0x09, 0x08, 0x10, 0x03, 0x10, 0x0f, 0x09, 0x0d,
+    0x0e, 0x01, 0x11, 0x07, 0x08, 0x03, 0x08, 0x05, 0x0c, 0x01, 0x02, 0x03,
+    0x02, 0x02, 0x03, 0x03, 0x12, 0x01, 0x01, 0x08, 0x06, 0x07, 0x01, 0x03,
+    0x12, 0x02, 0x01, 0x02, 0x06, 0x0a, 0x01, 0x06, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x03, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x09, 0x0a, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0b, 0x0b, 0x08, 0x08,
+    0x0b, 0x02, 0x01, 0x01, 0x11, 0x03, 0x01, 0x13, 0x03, 0x01, 0x01, 0x01,
+    0x08, 0x09, 0x01, 0x0b, 0x03, 0x04, 0x01, 0x01, 0x0e, 0x14, 0x01, 0x15,
+    0x03, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x0f, 0x0b, 0x02, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x04,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x0e, 0x0a, 0x01, 0x01, 0x01, 0x0e,
+    0x01, 0x11, 0x05, 0x0b, 0x01, 0x01, 0x04, 0x06, 0x03, 0x11, 0x03, 0x01,
+    0x01, 0x01, 0x01, 0x02, 0x04, 0x07, 0x03, 0x04, 0x01, 0x01, 0x01, 0x05,
+    0x0c, 0x04, 0x0e, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x08,
+    0x04, 0x01, 0x01, 0x02, 0x06, 0x06, 0x03, 0x06, 0x03, 0x04, 0x02, 0x03,
+    0x0b, 0x06, 0x0a, 0x11, 0x0b, 0x0a, 0x0a, 0x09, 0x03, 0x04, 0x06, 0x02,
+    0x02, 0x04, 0x0b, 0x03, 0x06, 0x01, 0x0b, 0x08, 0x07, 0x02, 0x06, 0x01,
+    0x11, 0x04, 0x05, 0x08, 0x04, 0x02, 0x06, 0x04, 0x01, 0x01, 0x01, 0x04,
+    0x03, 0x0d, 0x08, 0x01, 0x01, 0x01, 0x04, 0x08, 0x0b, 0x05, 0x07, 0x01,
+    0x04, 0x02, 0x01, 0x0a, 0x05, 0x03, 0x07, 0x01, 0x0a, 0x07, 0x0a, 0x03,
+    0x08, 0x03, 0x08, 0x01, 0x09, 0x11, 0x09, 0x08, 0x07, 0x05, 0x0e, 0x04,
+    0x01, 0x0b, 0x01, 0x06, 0x01, 0x06, 0x01, 0x04, 0x02, 0x03, 0x01, 0x03,
+    0x04, 0x03, 0x01, 0x04, 0x08, 0x03, 0x04, 0x03, 0x04, 0x02, 0x02, 0x01,
+    0x03, 0x01, 0x03, 0x06, 0x01, 0x04, 0x03, 0x04, 0x07, 0x01, 0x08, 0x0b,
+    0x02, 0x04, 0x03, 0x04, 0x02, 0x02, 0x08, 0x0b, 0x02, 0x01, 0x0a, 0x04,
+    0x04, 0x02, 0x0e, 0x10, 0x0e, 0x01, 0x02, 0x02, 0x01, 0x02, 0x0e, 0x10,
+    0x08, 0x04, 0x02, 0x04, 0x04, 0x04, 0x08, 0x06, 0x04, 0x03, 0x07, 0x01,
+    0x04, 0x04, 0x09, 0x07, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x16, 0x02,
+    0x02, 0x08, 0x08, 0x02, 0x05, 0x01, 0x08, 0x0a, 0x0f, 0x01, 0x12, 0x02,
+    0x06, 0x01, 0x04, 0x07, 0x17, 0x01, 0x09, 0x07, 0x06, 0x01, 0x01, 0x01,
+    0x13, 0x01, 0x11, 0x03, 0x06, 0x04, 0x02, 0x01, 0x18, 0x0e, 0x03, 0x11,
+    0x07, 0x04, 0x07, 0x04, 0x10, 0x06, 0x02, 0x11, 0x04, 0x02, 0x02, 0x03,
+    0x09, 0x03, 0x02, 0x06, 0x01, 0x04, 0x04, 0x0b, 0x12, 0x0e, 0x02, 0x05,
+    0x01, 0x01, 0x04, 0x0f, 0x06, 0x03, 0x03, 0x08, 0x0c, 0x05, 0x01, 0x02,
+    0x0a, 0x0b, 0x0e, 0x09, 0x0c, 0x06, 0x01, 0x01, 0x02, 0x0f, 0x0e, 0x09,
+    0x0e, 0x0b, 0x01, 0x04, 0x01, 0x14, 0x03, 0x06, 0x01, 0x09, 0x02, 0x19,
+    0x01, 0x0b, 0x06, 0x02, 0x01, 0x07, 0x01, 0x07, 0x04, 0x09, 0x10, 0x01,
+    0x01, 0x04, 0x01, 0x02, 0x03, 0x11, 0x06, 0x01, 0x02, 0x01, 0x01, 0x04,
+    0x06, 0x0b, 0x03, 0x01, 0x03, 0x01, 0x01, 0x01, 0x09, 0x10, 0x08, 0x07,
+    0x01, 0x09, 0x02, 0x0a, 0x0b, 0x07, 0x01, 0x01, 0x04, 0x12, 0x08, 0x0b,
+    0x0a, 0x0a, 0x0a, 0x02, 0x03, 0x03, 0x03, 0x09, 0x17, 0x09, 0x08, 0x02,
+    0x11, 0x0e, 0x0c, 0x05, 0x18, 0x10, 0x06, 0x0b, 0x11, 0x02, 0x02, 0x04,
+    0x0f, 0x0f, 0x08, 0x18, 0x11, 0x02, 0x04, 0x07, 0x0d, 0x0f, 0x03, 0x0f,
+    0x0a, 0x0e, 0x01, 0x08, 0x09, 0x10, 0x04, 0x0d, 0x03, 0x05, 0x01, 0x03,
+    0x0b, 0x0b, 0x01, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x04, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x0a, 0x06, 0x08, 0x07, 0x01, 0x01, 0x01, 0x01,
+    0x0b, 0x0f, 0x09, 0x03, 0x01, 0x0c, 0x04, 0x01, 0x10, 0x0f, 0x10, 0x0a,
+    0x14, 0x0f, 0x02, 0x01, 0x17, 0x06, 0x1a, 0x0b, 0x06, 0x03, 0x02, 0x01,
+    0x17, 0x11, 0x15, 0x09, 0x13, 0x09, 0x04, 0x01, 0x01, 0x01, 0x02, 0x0a,
+    0x08, 0x04, 0x0e, 0x08, 0x01, 0x01, 0x02, 0x06, 0x01, 0x02, 0x0e, 0x0e,
+    0x01, 0x01, 0x01, 0x03, 0x08, 0x01, 0x02, 0x0e, 0x01, 0x01, 0x01, 0x08,
+    0x02, 0x01, 0x07, 0x03, 0x01, 0x01, 0x04, 0x03, 0x0a, 0x01, 0x07, 0x08,
+    0x01, 0x01, 0x02, 0x0a, 0x02, 0x01, 0x04, 0x03, 0x01, 0x01, 0x02, 0x11,
+    0x08, 0x01, 0x04, 0x04, 0x01, 0x01, 0x01, 0x08, 0x02, 0x01, 0x04, 0x08,
+    0x06, 0x02, 0x08, 0x03, 0x02, 0x07, 0x03, 0x03, 0x05, 0x03, 0x01, 0x08,
+    0x02, 0x07, 0x02, 0x06, 0x03, 0x06, 0x01, 0x08, 0x02, 0x02, 0x01, 0x11,
+    0x03, 0x0b, 0x01, 0x0e, 0x08, 0x02, 0x04, 0x11, 0x08, 0x0b, 0x01, 0x04,
+    0x07, 0x02, 0x04, 0x06, 0x0e, 0x0f, 0x01, 0x02, 0x04, 0x08, 0x0e, 0x05,
+    0x05, 0x06, 0x01, 0x0a, 0x04, 0x01, 0x08, 0x09, 0x0a, 0x07, 0x01, 0x07,
+    0x04, 0x01, 0x0e, 0x12, 0x0a, 0x02, 0x07, 0x03, 0x02, 0x02, 0x07, 0x04,
+    0x0b, 0x04, 0x02, 0x02, 0x08, 0x03, 0x02, 0x02, 0x0a, 0x04, 0x03, 0x04,
+    0x03, 0x06, 0x02, 0x07, 0x0a, 0x04, 0x02, 0x02, 0x03, 0x06, 0x07, 0x03,
+    0x05, 0x02, 0x01, 0x03, 0x07, 0x06, 0x04, 0x03, 0x04, 0x0a, 0x01, 0x05,
+    0x08, 0x05, 0x01, 0x03, 0x04, 0x0a, 0x01, 0x08, 0x02, 0x0b, 0x0e, 0x03,
+    0x04, 0x06, 0x01, 0x02, 0x01, 0x0b, 0x01, 0x07, 0x01, 0x01, 0x16, 0x02,
+    0x05, 0x08, 0x0e, 0x02, 0x01, 0x01, 0x05, 0x03, 0x11, 0x02, 0x02, 0x02,
+    0x01, 0x01, 0x03, 0x03, 0x11, 0x08, 0x01, 0x07, 0x01, 0x04, 0x04, 0x06,
+    0x06, 0x08, 0x01, 0x02, 0x04, 0x04, 0x01, 0x09, 0x0a, 0x08, 0x01, 0x04,
+    0x04, 0x02, 0x01, 0x10, 0x03, 0x03, 0x01, 0x01, 0x04, 0x02, 0x01, 0x0f,
+    0x0e, 0x03, 0x02, 0x01, 0x07, 0x02, 0x01, 0x0b, 0x03, 0x08, 0x07, 0x01,
+    0x02, 0x01, 0x01, 0x10, 0x0b, 0x06, 0x05, 0x0e, 0x08, 0x01, 0x01, 0x0c,
+    0x05, 0x09, 0x08, 0x0e, 0x08, 0x02, 0x01, 0x02, 0x02, 0x08, 0x01, 0x01,
+    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x0a, 0x14, 0x03, 0x06,
+    0x05, 0x02, 0x01, 0x01, 0x0e, 0x11, 0x10, 0x0a, 0x08, 0x03, 0x02, 0x01,
+    0x02, 0x06, 0x10, 0x06, 0x04, 0x10, 0x03, 0x01, 0x01, 0x06, 0x16, 0x05,
+    0x01, 0x11, 0x03, 0x02, 0x01, 0x06, 0x17, 0x08, 0x01, 0x03, 0x07, 0x03,
+    0x01, 0x09, 0x1a, 0x03, 0x01, 0x0e, 0x07, 0x03, 0x01, 0x06, 0x1a, 0x08,
+    0x01, 0x03, 0x08, 0x0a, 0x01, 0x0c, 0x1a, 0x08, 0x08, 0x0a, 0x01, 0x03,
+    0x0d, 0x0a, 0x08, 0x09, 0x0e, 0x0a, 0x02, 0x08, 0x18, 0x02, 0x05, 0x03,
+    0x03, 0x08, 0x02, 0x02, 0x18, 0x02, 0x18, 0x03, 0x03, 0x02, 0x03, 0x07,
+    0x0b, 0x02, 0x1a, 0x07, 0x03, 0x01, 0x03, 0x05, 0x06, 0x02, 0x1b, 0x04,
+    0x03, 0x01, 0x02, 0x05, 0x08, 0x05, 0x15, 0x02, 0x05, 0x01, 0x02, 0x05,
+    0x04, 0x06, 0x15, 0x04, 0x03, 0x08, 0x01, 0x07, 0x02, 0x0b, 0x15, 0x01,
+    0x14, 0x11, 0x13, 0x0b, 0x0f, 0x0b, 0x08, 0x01, 0x10, 0x11, 0x17, 0x05,
+    0x05, 0x16, 0x08, 0x01, 0x0a, 0x0b, 0x0b, 0x08, 0x06, 0x06, 0x03, 0x05,
+    0x0c, 0x17, 0x03, 0x0b, 0x06, 0x18, 0x09, 0x05, 0x0a, 0x1a, 0x08, 0x0b,
+    0x03, 0x18, 0x0f, 0x05, 0x06, 0x17, 0x03, 0x0f, 0x08, 0x06, 0x17, 0x03,
+    0x09, 0x14, 0x02, 0x1a, 0x02, 0x06, 0x17, 0x0a, 0x0b, 0x0b, 0x05, 0x14,
+    0x08, 0x03, 0x17, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x0a, 0x03, 0x06, 0x02, 0x02, 0x01, 0x01, 0x01, 0x0f, 0x0b, 0x18, 0x06,
+    0x05, 0x01, 0x01, 0x01, 0x09, 0x0f, 0x1a, 0x0b, 0x06, 0x06, 0x15, 0x05,
+    0x03, 0x13, 0x06, 0x18, 0x10, 0x06, 0x06, 0x04, 0x01, 0x01, 0x01, 0x03,
+    0x08, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x0c, 0x0a, 0x01, 0x01, 0x03,
+    0x01, 0x01, 0x02, 0x06, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x0a,
+    0x03, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x08, 0x02, 0x01, 0x04,
+    0x01, 0x01, 0x01, 0x03, 0x11, 0x02, 0x04, 0x01, 0x01, 0x01, 0x02, 0x0a,
+    0x0c, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x06, 0x08, 0x02, 0x02, 0x01,
+    0x06, 0x02, 0x04, 0x08, 0x08, 0x01, 0x0e, 0x09, 0x0b, 0x04, 0x08, 0x08,
+    0x03, 0x01, 0x03, 0x06, 0x05, 0x05, 0x03, 0x0e, 0x08, 0x01, 0x0e, 0x03,
+    0x03, 0x06, 0x03, 0x0e, 0x02, 0x02, 0x0e, 0x0a, 0x03, 0x06, 0x03, 0x08,
+    0x04, 0x02, 0x0e, 0x06, 0x02, 0x0b, 0x02, 0x08, 0x01, 0x04, 0x02, 0x0b,
+    0x08, 0x10, 0x02, 0x08, 0x01, 0x04, 0x04, 0x06, 0x08, 0x0f, 0x0e, 0x02,
+    0x01, 0x01, 0x04, 0x08, 0x01, 0x09, 0x02, 0x04, 0x04, 0x09, 0x01, 0x02,
+    0x0e, 0x0a, 0x05, 0x04, 0x04, 0x09, 0x04, 0x02, 0x01, 0x08, 0x09, 0x02,
+    0x08, 0x12, 0x04, 0x07, 0x01, 0x07, 0x11, 0x01, 0x03, 0x0c, 0x02, 0x02,
+    0x01, 0x02, 0x11, 0x04, 0x02, 0x0c, 0x0e, 0x02, 0x01, 0x08, 0x0b, 0x04,
+    0x08, 0x03, 0x0e, 0x02, 0x01, 0x0a, 0x1c, 0x01, 0x03, 0x03, 0x02, 0x04,
+    0x04, 0x03, 0x03, 0x01, 0x12, 0x03, 0x04, 0x0c, 0x07, 0x0e, 0x01, 0x09,
+    0x0c, 0x03, 0x07, 0x01, 0x04, 0x08, 0x01, 0x06, 0x03, 0x0e, 0x02, 0x02,
+    0x02, 0x03, 0x04, 0x08, 0x0a, 0x0e, 0x0e, 0x02, 0x02, 0x03, 0x03, 0x02,
+    0x06, 0x08, 0x0e, 0x02, 0x02, 0x08, 0x06, 0x04, 0x11, 0x02, 0x0e, 0x02,
+    0x07, 0x0e, 0x0b, 0x01, 0x06, 0x04, 0x03, 0x08, 0x07, 0x02, 0x06, 0x04,
+    0x03, 0x01, 0x08, 0x11, 0x1d, 0x0c, 0x03, 0x0c, 0x06, 0x06, 0x09, 0x06,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0e,
+    0x0e, 0x1e, 0x0e, 0x0e, 0x01, 0x01, 0x0e, 0x0e, 0x0c, 0x0c, 0x12, 0x0c,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0e, 0x1e, 0x0e,
+    0x1d, 0x1d, 0x0c, 0x1d, 0x1e, 0x0c, 0x0c, 0x0c, 0x06, 0x12, 0x12, 0x0b,
+    0x0c, 0x0c, 0x0c, 0x06, 0x0c, 0x1f, 0x09, 0x0c, 0x06, 0x0c, 0x0c, 0x1f,
+    0x09, 0x12, 0x06, 0x09, 0x01, 0x0c, 0x08, 0x06, 0x01, 0x0e, 0x1a, 0x0c,
+    0x1e, 0x12, 0x03, 0x0a, 0x04, 0x02, 0x18, 0x03, 0x01, 0x12, 0x0a, 0x06,
+    0x03, 0x04, 0x18, 0x06, 0x01, 0x20, 0x06, 0x08, 0x0b, 0x04, 0x0b, 0x0b,
+    0x1d, 0x21, 0x0b, 0x04, 0x0f, 0x0e, 0x06, 0x0b, 0x0b, 0x0d, 0x09, 0x04,
+    0x17, 0x03, 0x03, 0x09, 0x0b, 0x12, 0x06, 0x02, 0x10, 0x03, 0x03, 0x08,
+    0x12, 0x12, 0x06, 0x0c, 0x0c, 0x0b, 0x12, 0x0c, 0x0e, 0x03, 0x01, 0x03,
+    0x02, 0x0b, 0x15, 0x01, 0x01, 0x05, 0x01, 0x03, 0x03, 0x09, 0x15, 0x01,
+    0x01, 0x06, 0x01, 0x06, 0x08, 0x0a, 0x15, 0x01, 0x01, 0x06, 0x01, 0x0a,
+    0x03, 0x05, 0x13, 0x01, 0x01, 0x09, 0x01, 0x03, 0x03, 0x03, 0x10, 0x01,
+    0x01, 0x14, 0x02, 0x0e, 0x1c, 0x0a, 0x09, 0x01, 0x01, 0x18, 0x09, 0x02,
+    0x05, 0x09, 0x06, 0x01, 0x09, 0x12, 0x12, 0x03, 0x05, 0x0a, 0x0b, 0x01,
+    0x0f, 0x05, 0x06, 0x10, 0x03, 0x03, 0x1a, 0x04, 0x18, 0x02, 0x06, 0x14,
+    0x03, 0x05, 0x0f, 0x02, 0x0b, 0x08, 0x06, 0x09, 0x03, 0x09, 0x12, 0x08,
+    0x11, 0x0a, 0x0a, 0x11, 0x02, 0x10, 0x03, 0x0b, 0x11, 0x06, 0x06, 0x09,
+    0x07, 0x0b, 0x04, 0x17, 0x09, 0x0b, 0x11, 0x06, 0x06, 0x0b, 0x01, 0x1a,
+    0x09, 0x0b, 0x06, 0x0a, 0x06, 0x05, 0x01, 0x15, 0x06, 0x0b, 0x0f, 0x0a,
+    0x06, 0x02, 0x02, 0x15, 0x0c, 0x15, 0x05, 0x15, 0x10, 0x10, 0x10, 0x02,
+    0x0a, 0x15, 0x03, 0x1b, 0x0b, 0x1a, 0x10, 0x03, 0x08, 0x18, 0x05, 0x13,
+    0x06, 0x0a, 0x10, 0x03, 0x03, 0x0a, 0x09, 0x0b, 0x03, 0x0a, 0x09, 0x03,
+    0x0a, 0x02, 0x1a, 0x0c, 0x06, 0x09, 0x0f, 0x0a, 0x03, 0x04, 0x15, 0x02,
+    0x11, 0x03, 0x1a, 0x0f, 0x03, 0x08, 0x15, 0x02, 0x0f, 0x06, 0x08, 0x1a,
+    0x07, 0x06, 0x1a, 0x04, 0x17, 0x03, 0x0e, 0x1a, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x02, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x06, 0x08, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x06, 0x08, 0x03, 0x03, 0x07, 0x01, 0x02, 0x01, 0x06, 0x09, 0x10, 0x0f,
+    0x05, 0x05, 0x04, 0x01, 0x06, 0x0a, 0x14, 0x18, 0x0b, 0x0b, 0x08, 0x14,
+    0x01, 0x01, 0x01, 0x03, 0x03, 0x02, 0x07, 0x01, 0x01, 0x01, 0x01, 0x03,
+    0x08, 0x02, 0x0a, 0x01, 0x01, 0x01, 0x04, 0x03, 0x06, 0x04, 0x03, 0x04,
+    0x01, 0x01, 0x02, 0x0a, 0x02, 0x02, 0x03, 0x04, 0x01, 0x01, 0x02, 0x06,
+    0x08, 0x02, 0x08, 0x0a, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x11,
+    0x01, 0x01, 0x01, 0x05, 0x03, 0x07, 0x04, 0x09, 0x01, 0x01, 0x02, 0x0a,
+    0x03, 0x02, 0x04, 0x0b, 0x0e, 0x10, 0x0e, 0x02, 0x04, 0x01, 0x01, 0x04,
+    0x02, 0x0d, 0x08, 0x02, 0x07, 0x01, 0x01, 0x04, 0x04, 0x0b, 0x08, 0x01,
+    0x08, 0x01, 0x01, 0x07, 0x01, 0x06, 0x03, 0x01, 0x03, 0x01, 0x01, 0x0c,
+    0x04, 0x0a, 0x06, 0x01, 0x03, 0x01, 0x01, 0x09, 0x02, 0x03, 0x06, 0x01,
+    0x03, 0x01, 0x02, 0x09, 0x03, 0x02, 0x05, 0x01, 0x06, 0x01, 0x0e, 0x09,
+    0x08, 0x02, 0x03, 0x01, 0x0b, 0x03, 0x02, 0x12, 0x02, 0x06, 0x04, 0x01,
+    0x09, 0x03, 0x02, 0x06, 0x02, 0x06, 0x01, 0x01, 0x0b, 0x08, 0x0e, 0x0e,
+    0x02, 0x11, 0x01, 0x01, 0x06, 0x08, 0x12, 0x0e, 0x04, 0x0b, 0x02, 0x01,
+    0x06, 0x0a, 0x0c, 0x12, 0x01, 0x0a, 0x02, 0x01, 0x08, 0x0c, 0x10, 0x0b,
+    0x01, 0x03, 0x02, 0x22, 0x22, 0x0c, 0x09, 0x1f, 0x01, 0x08, 0x0e, 0x10,
+    0x0b, 0x0b, 0x12, 0x06, 0x0e, 0x1d, 0x09, 0x1d, 0x1d, 0x0c, 0x09, 0x06,
+    0x0f, 0x09, 0x09, 0x10, 0x10, 0x0b, 0x0b, 0x09, 0x0c, 0x0c, 0x0b, 0x10,
+    0x12, 0x1d, 0x1d, 0x0c, 0x0b, 0x09, 0x06, 0x06, 0x09, 0x1d, 0x06, 0x12,
+    0x09, 0x09, 0x12, 0x12, 0x0e, 0x0b, 0x12, 0x09, 0x10, 0x06, 0x23, 0x0c,
+    0x09, 0x12, 0x12, 0x09, 0x0c, 0x09, 0x0b, 0x12, 0x0c, 0x06, 0x12, 0x0c,
+    0x12, 0x12, 0x12, 0x0c, 0x0c, 0x10, 0x0b, 0x0b, 0x06, 0x12, 0x0b, 0x0b,
+    0x0b, 0x0c, 0x1d, 0x1d, 0x1d, 0x10, 0x0b, 0x09, 0x0b, 0x10, 0x0b, 0x0d,
+    0x0c, 0x1d, 0x1f, 0x09, 0x10, 0x12, 0x0c, 0x0e, 0x12, 0x0b, 0x09, 0x06,
+    0x1f, 0x0b, 0x0e, 0x09, 0x1f, 0x12, 0x0b, 0x12, 0x12, 0x0e, 0x09, 0x09,
+    0x09, 0x10, 0x12, 0x23, 0x0c, 0x09, 0x09, 0x0c, 0x0b, 0x0c, 0x12, 0x0b,
+    0x12, 0x0c, 0x0c, 0x0b, 0x12, 0x0b, 0x06, 0x09, 0x06, 0x0c, 0x0b, 0x0b,
+    0x0b, 0x06, 0x12, 0x0b, 0x0b, 0x0b, 0x1f, 0x1d, 0x09, 0x0c, 0x0b, 0x06,
+    0x03, 0x06, 0x09, 0x04, 0x0c, 0x1f, 0x1d, 0x0c, 0x07, 0x16, 0x10, 0x04,
+    0x06, 0x12, 0x0b, 0x0b, 0x0c, 0x10, 0x10, 0x07, 0x09, 0x06, 0x06, 0x0b,
+    0x0c, 0x10, 0x10, 0x03, 0x09, 0x09, 0x10, 0x09, 0x0c, 0x03, 0x10, 0x03,
+    0x0c, 0x12, 0x1f, 0x06, 0x10, 0x0c, 0x03, 0x09, 0x0b, 0x12, 0x0b, 0x06,
+    0x09, 0x06, 0x0c, 0x06, 0x1d, 0x12, 0x12, 0x12, 0x0b, 0x0b, 0x0b, 0x06,
+    0x03, 0x09, 0x18, 0x05, 0x08, 0x02, 0x03, 0x15, 0x04, 0x09, 0x17, 0x07,
+    0x07, 0x02, 0x03, 0x15, 0x01, 0x0a, 0x1b, 0x04, 0x03, 0x03, 0x03, 0x15,
+    0x04, 0x06, 0x14, 0x04, 0x0a, 0x0a, 0x02, 0x15, 0x04, 0x0b, 0x10, 0x04,
+    0x0a, 0x06, 0x04, 0x15, 0x04, 0x0b, 0x12, 0x02, 0x03, 0x05, 0x04, 0x17,
+    0x02, 0x03, 0x03, 0x05, 0x03, 0x05, 0x07, 0x10, 0x12, 0x1f, 0x02, 0x0b,
+    0x08, 0x05, 0x03, 0x10, 0x04, 0x09, 0x0f, 0x02, 0x1a, 0x03, 0x02, 0x1a,
+    0x04, 0x10, 0x06, 0x03, 0x18, 0x08, 0x04, 0x15, 0x04, 0x0f, 0x03, 0x07,
+    0x17, 0x03, 0x02, 0x1a, 0x04, 0x0b, 0x08, 0x05, 0x10, 0x0a, 0x08, 0x14,
+    0x04, 0x0a, 0x06, 0x0a, 0x06, 0x03, 0x06, 0x10, 0x04, 0x0a, 0x06, 0x09,
+    0x06, 0x05, 0x09, 0x08, 0x04, 0x06, 0x06, 0x0f, 0x03, 0x09, 0x09, 0x04,
+    0x01, 0x0a, 0x09, 0x10, 0x08, 0x0b, 0x06, 0x01, 0x06, 0x02, 0x1b, 0x0b,
+    0x10, 0x0f, 0x06, 0x0f, 0x07, 0x01, 0x15, 0x06, 0x18, 0x1a, 0x06, 0x10,
+    0x07, 0x04, 0x15, 0x05, 0x17, 0x16, 0x17, 0x0f, 0x02, 0x08, 0x13, 0x0a,
+    0x17, 0x0b, 0x09, 0x10, 0x08, 0x0a, 0x06, 0x06, 0x0b, 0x06, 0x0a, 0x1a,
+    0x09, 0x10, 0x02, 0x18, 0x12, 0x0a, 0x09, 0x06, 0x0b, 0x0d, 0x01, 0x15,
+    0x0a, 0x0a, 0x14, 0x18, 0x17, 0x0d, 0x01, 0x1a, 0x0a, 0x0b, 0x0b, 0x0f,
+    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x04, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x06, 0x04, 0x0e, 0x0e, 0x0e,
+    0x01, 0x01, 0x01, 0x03, 0x06, 0x12, 0x0c, 0x06, 0x01, 0x01, 0x01, 0x07,
+    0x08, 0x0c, 0x0c, 0x09, 0x01, 0x01, 0x04, 0x03, 0x06, 0x0c, 0x0c, 0x1d,
+    0x01, 0x01, 0x04, 0x0a, 0x03, 0x1f, 0x0c, 0x0c, 0x01, 0x02, 0x06, 0x09,
+    0x0e, 0x0c, 0x1e, 0x1e, 0x02, 0x06, 0x0b, 0x07, 0x03, 0x1f, 0x06, 0x06,
+    0x0e, 0x05, 0x03, 0x03, 0x02, 0x24, 0x0c, 0x1e, 0x01, 0x01, 0x02, 0x04,
+    0x0c, 0x1f, 0x1d, 0x1f, 0x01, 0x01, 0x04, 0x01, 0x06, 0x0c, 0x0c, 0x0c,
+    0x01, 0x01, 0x01, 0x01, 0x0c, 0x0e, 0x1e, 0x0e, 0x01, 0x01, 0x04, 0x01,
+    0x0c, 0x1f, 0x0c, 0x06, 0x01, 0x01, 0x04, 0x09, 0x0e, 0x0c, 0x1d, 0x1e,
+    0x01, 0x02, 0x07, 0x09, 0x1f, 0x06, 0x09, 0x12, 0x01, 0x04, 0x03, 0x08,
+    0x0e, 0x0c, 0x1e, 0x1e, 0x01, 0x01, 0x07, 0x06, 0x12, 0x1d, 0x1d, 0x12,
+    0x0c, 0x1d, 0x1d, 0x0b, 0x0b, 0x0b, 0x16, 0x06, 0x1e, 0x1f, 0x10, 0x0d,
+    0x09, 0x09, 0x09, 0x06, 0x06, 0x0c, 0x10, 0x09, 0x0c, 0x1d, 0x1d, 0x0e,
+    0x0c, 0x0c, 0x0b, 0x0c, 0x0c, 0x12, 0x09, 0x0b, 0x0e, 0x06, 0x06, 0x24,
+    0x09, 0x09, 0x0b, 0x0c, 0x0c, 0x1d, 0x0c, 0x0b, 0x06, 0x1f, 0x12, 0x0b,
+    0x06, 0x12, 0x0b, 0x1f, 0x06, 0x09, 0x06, 0x0b, 0x12, 0x0c, 0x1d, 0x0c,
+    0x10, 0x06, 0x0b, 0x12, 0x0c, 0x09, 0x0c, 0x23, 0x09, 0x10, 0x0b, 0x0b,
+    0x0f, 0x06, 0x12, 0x0d, 0x10, 0x12, 0x09, 0x0b, 0x12, 0x06, 0x0b, 0x10,
+    0x0b, 0x06, 0x1d, 0x1d, 0x12, 0x09, 0x06, 0x12, 0x09, 0x1d, 0x12, 0x12,
+    0x09, 0x12, 0x09, 0x12, 0x1e, 0x0b, 0x09, 0x0b, 0x0b, 0x06, 0x1e, 0x0c,
+    0x09, 0x12, 0x0c, 0x12, 0x12, 0x09, 0x0b, 0x0b, 0x06, 0x0c, 0x09, 0x06,
+    0x0c, 0x06, 0x06, 0x0c, 0x23, 0x10, 0x12, 0x09, 0x0b, 0x06, 0x06, 0x09,
+    0x12, 0x0b, 0x09, 0x03, 0x10, 0x0b, 0x1f, 0x0c, 0x1e, 0x11, 0x0a, 0x0b,
+    0x0c, 0x1d, 0x12, 0x12, 0x12, 0x06, 0x09, 0x03, 0x1d, 0x12, 0x06, 0x09,
+    0x1f, 0x08, 0x18, 0x05, 0x12, 0x0b, 0x0c, 0x06, 0x12, 0x03, 0x14, 0x03,
+    0x12, 0x0c, 0x0b, 0x12, 0x0b, 0x10, 0x14, 0x04, 0x1d, 0x0b, 0x06, 0x06,
+    0x12, 0x0a, 0x06, 0x08, 0x06, 0x10, 0x0b, 0x09, 0x12, 0x1a, 0x10, 0x02,
+    0x06, 0x03, 0x02, 0x06, 0x06, 0x09, 0x0e, 0x01, 0x03, 0x0a, 0x0b, 0x08,
+    0x03, 0x08, 0x04, 0x01, 0x07, 0x02, 0x08, 0x01, 0x02, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x0b, 0x0b, 0x12, 0x06, 0x03, 0x06, 0x02, 0x14,
+    0x0b, 0x09, 0x12, 0x12, 0x0b, 0x05, 0x07, 0x0f, 0x1d, 0x1d, 0x1d, 0x0e,
+    0x12, 0x08, 0x05, 0x18, 0x12, 0x12, 0x09, 0x0b, 0x12, 0x0c, 0x06, 0x1a,
+    0x09, 0x09, 0x09, 0x23, 0x0b, 0x0c, 0x06, 0x17, 0x0c, 0x12, 0x12, 0x10,
+    0x0b, 0x0c, 0x08, 0x17, 0x09, 0x12, 0x06, 0x09, 0x09, 0x0b, 0x06, 0x03,
+    0x0b, 0x06, 0x0b, 0x12, 0x1d, 0x12, 0x06, 0x0c, 0x01, 0x0a, 0x06, 0x18,
+    0x08, 0x0b, 0x08, 0x04, 0x04, 0x03, 0x0a, 0x1b, 0x03, 0x06, 0x02, 0x02,
+    0x02, 0x04, 0x03, 0x13, 0x03, 0x08, 0x07, 0x07, 0x07, 0x04, 0x08, 0x15,
+    0x08, 0x08, 0x03, 0x02, 0x07, 0x02, 0x02, 0x1b, 0x07, 0x03, 0x0a, 0x04,
+    0x03, 0x07, 0x08, 0x1a, 0x04, 0x03, 0x09, 0x01, 0x06, 0x02, 0x03, 0x14,
+    0x04, 0x03, 0x06, 0x04, 0x06, 0x08, 0x02, 0x0b, 0x02, 0x0a, 0x05, 0x02,
+    0x15, 0x09, 0x03, 0x18, 0x05, 0x14, 0x03, 0x0f, 0x15, 0x0c, 0x06, 0x0b,
+    0x05, 0x14, 0x11, 0x18, 0x15, 0x0c, 0x0b, 0x06, 0x05, 0x1a, 0x07, 0x0b,
+    0x15, 0x0c, 0x0b, 0x0a, 0x02, 0x1a, 0x0b, 0x18, 0x15, 0x0a, 0x09, 0x03,
+    0x07, 0x0f, 0x0a, 0x10, 0x17, 0x0c, 0x03, 0x06, 0x0a, 0x06, 0x0a, 0x1a,
+    0x17, 0x03, 0x08, 0x06, 0x06, 0x03, 0x0b, 0x0b, 0x0b, 0x02, 0x03, 0x06,
+    0x0f, 0x07, 0x10, 0x0f, 0x0b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x04, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x06,
+    0x08, 0x05, 0x0b, 0x0a, 0x0e, 0x01, 0x03, 0x09, 0x05, 0x0b, 0x09, 0x06,
+    0x07, 0x06, 0x03, 0x0b, 0x01, 0x02, 0x02, 0x02, 0x01, 0x07, 0x04, 0x06,
+    0x01, 0x03, 0x07, 0x08, 0x04, 0x09, 0x01, 0x05, 0x01, 0x05, 0x0a, 0x04,
+    0x08, 0x0a, 0x01, 0x03, 0x01, 0x0a, 0x06, 0x01, 0x05, 0x03, 0x01, 0x03,
+    0x01, 0x03, 0x06, 0x01, 0x04, 0x06, 0x01, 0x08, 0x01, 0x08, 0x09, 0x0e,
+    0x07, 0x0b, 0x02, 0x01, 0x0a, 0x0e, 0x05, 0x03, 0x0a, 0x06, 0x09, 0x08,
+    0x10, 0x03, 0x10, 0x09, 0x09, 0x04, 0x02, 0x05, 0x11, 0x01, 0x08, 0x06,
+    0x0b, 0x04, 0x07, 0x09, 0x04, 0x04, 0x02, 0x08, 0x09, 0x04, 0x02, 0x09,
+    0x04, 0x02, 0x02, 0x03, 0x0a, 0x07, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07,
+    0x04, 0x03, 0x02, 0x02, 0x03, 0x0b, 0x03, 0x04, 0x04, 0x03, 0x04, 0x02,
+    0x08, 0x11, 0x02, 0x02, 0x05, 0x03, 0x07, 0x03, 0x03, 0x0c, 0x09, 0x12,
+    0x03, 0x03, 0x07, 0x0e, 0x03, 0x0c, 0x23, 0x1e, 0x08, 0x08, 0x04, 0x03,
+    0x08, 0x0c, 0x1d, 0x0c, 0x0e, 0x02, 0x02, 0x02, 0x03, 0x06, 0x0c, 0x09,
+    0x08, 0x02, 0x02, 0x02, 0x0e, 0x1d, 0x06, 0x0c, 0x03, 0x02, 0x01, 0x07,
+    0x05, 0x1f, 0x0c, 0x0c, 0x07, 0x02, 0x08, 0x03, 0x0e, 0x1f, 0x0e, 0x0e,
+    0x03, 0x04, 0x0a, 0x05, 0x03, 0x06, 0x0c, 0x12, 0x01, 0x01, 0x04, 0x07,
+    0x06, 0x1d, 0x06, 0x09, 0x01, 0x01, 0x04, 0x11, 0x23, 0x0c, 0x0c, 0x06,
+    0x01, 0x01, 0x08, 0x0c, 0x12, 0x0c, 0x0c, 0x0c, 0x01, 0x01, 0x05, 0x03,
+    0x0c, 0x1d, 0x0e, 0x0e, 0x01, 0x01, 0x04, 0x0a, 0x12, 0x0c, 0x0c, 0x12,
+    0x01, 0x01, 0x02, 0x03, 0x1e, 0x1d, 0x1d, 0x1e, 0x01, 0x01, 0x02, 0x06,
+    0x06, 0x12, 0x12, 0x0c, 0x01, 0x01, 0x08, 0x03, 0x0e, 0x0c, 0x1e, 0x1d,
+    0x0b, 0x12, 0x0b, 0x06, 0x0b, 0x06, 0x0c, 0x09, 0x1d, 0x09, 0x06, 0x06,
+    0x09, 0x12, 0x0b, 0x12, 0x0b, 0x09, 0x1f, 0x06, 0x06, 0x23, 0x1f, 0x0b,
+    0x0b, 0x0c, 0x0b, 0x0b, 0x12, 0x0b, 0x0f, 0x09, 0x1d, 0x1d, 0x1d, 0x12,
+    0x12, 0x06, 0x06, 0x0a, 0x12, 0x0b, 0x0b, 0x12, 0x0a, 0x11, 0x03, 0x09,
+    0x0b, 0x06, 0x0c, 0x0b, 0x16, 0x0a, 0x02, 0x07, 0x12, 0x09, 0x16, 0x0b,
+    0x17, 0x08, 0x04, 0x01, 0x10, 0x0b, 0x0b, 0x09, 0x12, 0x09, 0x12, 0x0c,
+    0x1d, 0x1d, 0x12, 0x12, 0x12, 0x09, 0x09, 0x0b, 0x0b, 0x12, 0x06, 0x14,
+    0x0e, 0x05, 0x0e, 0x1f, 0x06, 0x16, 0x07, 0x0a, 0x11, 0x0a, 0x09, 0x03,
+    0x02, 0x0a, 0x02, 0x04, 0x03, 0x02, 0x07, 0x04, 0x03, 0x01, 0x04, 0x01,
+    0x02, 0x01, 0x04, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x10, 0x0b, 0x0b,
+    0x12, 0x17, 0x0f, 0x02, 0x09, 0x0c, 0x1d, 0x0c, 0x09, 0x10, 0x0f, 0x05,
+    0x06, 0x03, 0x09, 0x0a, 0x0b, 0x0e, 0x0e, 0x01, 0x0a, 0x06, 0x09, 0x03,
+    0x0a, 0x01, 0x01, 0x01, 0x04, 0x06, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01,
+    0x01, 0x02, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x06, 0x0b, 0x06, 0x06, 0x05, 0x07, 0x03, 0x04, 0x06, 0x06, 0x10, 0x0f,
+    0x0a, 0x01, 0x02, 0x01, 0x09, 0x0b, 0x1a, 0x06, 0x01, 0x01, 0x01, 0x01,
+    0x0b, 0x0c, 0x0b, 0x08, 0x01, 0x01, 0x01, 0x01, 0x1f, 0x18, 0x17, 0x08,
+    0x01, 0x01, 0x01, 0x01, 0x0b, 0x06, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x12, 0x0a, 0x18, 0x0b, 0x04, 0x01, 0x01, 0x01, 0x1d, 0x09, 0x10, 0x02,
+    0x01, 0x01, 0x01, 0x01, 0x06, 0x0c, 0x0c, 0x0e, 0x06, 0x06, 0x03, 0x03,
+    0x0b, 0x10, 0x0b, 0x1f, 0x0a, 0x06, 0x05, 0x02, 0x0b, 0x06, 0x12, 0x09,
+    0x12, 0x0b, 0x05, 0x02, 0x10, 0x12, 0x1d, 0x1d, 0x1e, 0x0b, 0x03, 0x03,
+    0x1d, 0x0c, 0x09, 0x0b, 0x0b, 0x0c, 0x12, 0x03, 0x1d, 0x12, 0x06, 0x0b,
+    0x0c, 0x0b, 0x0c, 0x06, 0x09, 0x09, 0x0c, 0x06, 0x09, 0x0b, 0x06, 0x03,
+    0x12, 0x0c, 0x0b, 0x12, 0x0b, 0x10, 0x09, 0x06, 0x10, 0x04, 0x0e, 0x0b,
+    0x0f, 0x01, 0x1a, 0x10, 0x0f, 0x02, 0x08, 0x09, 0x14, 0x02, 0x09, 0x10,
+    0x0f, 0x02, 0x08, 0x06, 0x1a, 0x03, 0x10, 0x1a, 0x18, 0x03, 0x04, 0x03,
+    0x18, 0x0a, 0x0a, 0x06, 0x1a, 0x03, 0x04, 0x02, 0x1a, 0x06, 0x06, 0x1a,
+    0x1a, 0x03, 0x02, 0x04, 0x17, 0x06, 0x0c, 0x0f, 0x17, 0x03, 0x03, 0x02,
+    0x1a, 0x07, 0x04, 0x18, 0x03, 0x06, 0x0e, 0x02, 0x1a, 0x04, 0x06, 0x14,
+    0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x09, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x04, 0x03, 0x01, 0x02, 0x02, 0x03, 0x0b, 0x0e,
+    0x02, 0x11, 0x01, 0x04, 0x02, 0x0e, 0x0b, 0x0e, 0x08, 0x03, 0x01, 0x01,
+    0x02, 0x0e, 0x0d, 0x0c, 0x03, 0x06, 0x04, 0x01, 0x04, 0x02, 0x06, 0x0e,
+    0x01, 0x03, 0x04, 0x04, 0x04, 0x06, 0x03, 0x04, 0x02, 0x06, 0x01, 0x01,
+    0x04, 0x0b, 0x08, 0x02, 0x08, 0x06, 0x02, 0x01, 0x01, 0x16, 0x08, 0x03,
+    0x03, 0x08, 0x04, 0x01, 0x01, 0x05, 0x03, 0x11, 0x01, 0x0c, 0x02, 0x01,
+    0x05, 0x11, 0x02, 0x01, 0x01, 0x07, 0x02, 0x04, 0x05, 0x03, 0x08, 0x02,
+    0x01, 0x02, 0x02, 0x04, 0x06, 0x02, 0x07, 0x0e, 0x08, 0x07, 0x01, 0x01,
+    0x10, 0x02, 0x03, 0x02, 0x02, 0x07, 0x01, 0x01, 0x0b, 0x01, 0x0a, 0x08,
+    0x08, 0x08, 0x02, 0x01, 0x0b, 0x01, 0x12, 0x08, 0x08, 0x0e, 0x02, 0x01,
+    0x0b, 0x01, 0x09, 0x04, 0x02, 0x02, 0x07, 0x01, 0x11, 0x01, 0x03, 0x02,
+    0x02, 0x08, 0x08, 0x06, 0x02, 0x1e, 0x0c, 0x1e, 0x04, 0x06, 0x02, 0x03,
+    0x08, 0x1f, 0x09, 0x1f, 0x04, 0x06, 0x04, 0x03, 0x0e, 0x0c, 0x23, 0x0e,
+    0x01, 0x03, 0x02, 0x0a, 0x09, 0x06, 0x0c, 0x0c, 0x04, 0x02, 0x02, 0x06,
+    0x02, 0x06, 0x1d, 0x0c, 0x02, 0x04, 0x04, 0x06, 0x0e, 0x0c, 0x06, 0x0c,
+    0x0a, 0x04, 0x02, 0x06, 0x02, 0x06, 0x23, 0x1d, 0x06, 0x07, 0x02, 0x09,
+    0x01, 0x1d, 0x0c, 0x1f, 0x01, 0x01, 0x08, 0x08, 0x0e, 0x0c, 0x09, 0x1d,
+    0x01, 0x01, 0x0a, 0x09, 0x11, 0x03, 0x0c, 0x06, 0x01, 0x01, 0x02, 0x02,
+    0x08, 0x03, 0x03, 0x1e, 0x01, 0x01, 0x01, 0x01, 0x02, 0x06, 0x06, 0x16,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x12, 0x0c, 0x0f, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x06, 0x14, 0x0f, 0x0a, 0x01, 0x01, 0x01, 0x01,
+    0x06, 0x0c, 0x10, 0x09, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0b, 0x1a, 0x0a,
+    0x01, 0x01, 0x01, 0x01, 0x0b, 0x03, 0x06, 0x08, 0x01, 0x01, 0x01, 0x01,
+    0x1f, 0x18, 0x1a, 0x07, 0x01, 0x01, 0x01, 0x01, 0x0b, 0x09, 0x0f, 0x11,
+    0x01, 0x01, 0x01, 0x01, 0x0b, 0x08, 0x0e, 0x02, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x06, 0x07, 0x01, 0x01, 0x08, 0x03, 0x11, 0x04, 0x08, 0x03, 0x01,
+    0x04, 0x02, 0x0a, 0x06, 0x04, 0x11, 0x0a, 0x01, 0x04, 0x01, 0x06, 0x06,
+    0x03, 0x0c, 0x03, 0x04, 0x02, 0x01, 0x0b, 0x03, 0x05, 0x03, 0x08, 0x04,
+    0x02, 0x01, 0x10, 0x03, 0x01, 0x0a, 0x08, 0x02, 0x04, 0x01, 0x09, 0x0c,
+    0x02, 0x05, 0x02, 0x07, 0x0e, 0x01, 0x06, 0x0c, 0x02, 0x06, 0x08, 0x04,
+    0x03, 0x01, 0x0a, 0x03, 0x08, 0x01, 0x07, 0x01, 0x11, 0x04, 0x02, 0x03,
+    0x08, 0x01, 0x07, 0x01, 0x11, 0x02, 0x01, 0x06, 0x08, 0x01, 0x04, 0x01,
+    0x11, 0x08, 0x01, 0x10, 0x03, 0x04, 0x01, 0x04, 0x08, 0x03, 0x04, 0x0b,
+    0x03, 0x04, 0x01, 0x04, 0x02, 0x07, 0x04, 0x06, 0x08, 0x07, 0x01, 0x01,
+    0x01, 0x04, 0x03, 0x03, 0x03, 0x07, 0x01, 0x04, 0x01, 0x04, 0x06, 0x08,
+    0x0e, 0x02, 0x02, 0x01, 0x02, 0x04, 0x06, 0x03, 0x03, 0x07, 0x0e, 0x1c,
+    0x0e, 0x1f, 0x0c, 0x0c, 0x03, 0x02, 0x01, 0x11, 0x0e, 0x1f, 0x0c, 0x09,
+    0x02, 0x02, 0x02, 0x0a, 0x01, 0x0c, 0x0c, 0x0c, 0x02, 0x04, 0x08, 0x03,
+    0x0e, 0x06, 0x0c, 0x0c, 0x02, 0x0e, 0x0a, 0x03, 0x02, 0x0c, 0x0c, 0x06,
+    0x04, 0x0e, 0x09, 0x02, 0x23, 0x12, 0x1f, 0x0c, 0x01, 0x0e, 0x0b, 0x02,
+    0x1d, 0x1e, 0x23, 0x1f, 0x01, 0x01, 0x0b, 0x02, 0x1f, 0x0c, 0x0c, 0x09,
+    0x01, 0x01, 0x01, 0x01, 0x0e, 0x11, 0x09, 0x03, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x0a, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x04,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x0a, 0x06, 0x0a, 0x0b, 0x08, 0x0a, 0x03, 0x09,
+    0x02, 0x07, 0x03, 0x02, 0x01, 0x04, 0x06, 0x03, 0x01, 0x01, 0x02, 0x01,
+    0x01, 0x01, 0x05, 0x0e, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x07,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x10, 0x0b, 0x0b,
+    0x0b, 0x12, 0x05, 0x11, 0x10, 0x0b, 0x12, 0x0e, 0x1d, 0x1e, 0x07, 0x03,
+    0x12, 0x0d, 0x0e, 0x12, 0x12, 0x08, 0x03, 0x04, 0x0e, 0x0e, 0x0c, 0x0b,
+    0x03, 0x03, 0x0e, 0x01, 0x06, 0x0b, 0x0a, 0x04, 0x0b, 0x05, 0x04, 0x01,
+    0x03, 0x08, 0x03, 0x09, 0x03, 0x0e, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03,
+    0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01,
+    0x0a, 0x0b, 0x08, 0x0a, 0x06, 0x06, 0x05, 0x05, 0x0e, 0x07, 0x01, 0x04,
+    0x0a, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x04, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x06, 0x0a, 0x0b, 0x08, 0x05, 0x11, 0x0a, 0x06,
+    0x02, 0x03, 0x02, 0x04, 0x04, 0x05, 0x02, 0x02, 0x01, 0x02, 0x01, 0x01,
+    0x01, 0x02, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x12, 0x09, 0x0c, 0x0b,
+    0x09, 0x0b, 0x0b, 0x17, 0x0c, 0x23, 0x09, 0x06, 0x06, 0x0b, 0x0c, 0x11,
+    0x06, 0x06, 0x10, 0x0b, 0x0b, 0x0c, 0x17, 0x18, 0x12, 0x0b, 0x0c, 0x1d,
+    0x0c, 0x0b, 0x06, 0x10, 0x06, 0x0b, 0x12, 0x12, 0x0b, 0x12, 0x03, 0x17,
+    0x10, 0x10, 0x0b, 0x0b, 0x09, 0x1d, 0x0b, 0x10, 0x10, 0x12, 0x1d, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x10, 0x12, 0x12, 0x0c, 0x06, 0x12, 0x12, 0x14, 0x0f,
+    0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x04, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x01, 0x08, 0x05,
+    0x03, 0x06, 0x02, 0x02, 0x03, 0x08, 0x02, 0x06, 0x01, 0x08, 0x02, 0x02,
+    0x08, 0x06, 0x04, 0x11, 0x02, 0x11, 0x02, 0x07, 0x0e, 0x0b, 0x01, 0x06,
+    0x08, 0x0a, 0x02, 0x07, 0x02, 0x0b, 0x04, 0x05, 0x06, 0x08, 0x0e, 0x0e,
+    0x0e, 0x0e, 0x03, 0x23, 0x04, 0x09, 0x09, 0x0c, 0x0c, 0x09, 0x12, 0x1f,
+    0x04, 0x04, 0x0c, 0x23, 0x06, 0x09, 0x06, 0x0e, 0x0e, 0x02, 0x0e, 0x01,
+    0x03, 0x01, 0x0a, 0x05, 0x08, 0x02, 0x02, 0x01, 0x06, 0x22, 0x0e, 0x03,
+    0x07, 0x0e, 0x08, 0x01, 0x0b, 0x01, 0x01, 0x05, 0x04, 0x0e, 0x03, 0x01,
+    0x0b, 0x02, 0x04, 0x08, 0x01, 0x08, 0x0b, 0x04, 0x06, 0x0e, 0x0e, 0x12,
+    0x0e, 0x03, 0x0c, 0x03, 0x03, 0x0c, 0x0c, 0x09, 0x1f, 0x0c, 0x23, 0x10,
+    0x12, 0x12, 0x0b, 0x10, 0x23, 0x23, 0x1e, 0x0c, 0x12, 0x0b, 0x10, 0x09,
+    0x01, 0x01, 0x10, 0x02, 0x06, 0x09, 0x12, 0x12, 0x01, 0x01, 0x08, 0x09,
+    0x10, 0x12, 0x1d, 0x0c, 0x01, 0x1e, 0x1e, 0x0b, 0x0c, 0x12, 0x16, 0x12,
+    0x12, 0x10, 0x0b, 0x12, 0x0b, 0x06, 0x09, 0x06, 0x1f, 0x1d, 0x1d, 0x0b,
+    0x06, 0x12, 0x0b, 0x09, 0x0d, 0x0b, 0x0b, 0x12, 0x0c, 0x12, 0x0c, 0x0e,
+    0x12, 0x0b, 0x0b, 0x0c, 0x10, 0x0b, 0x12, 0x0b, 0x06, 0x1d, 0x1d, 0x1d,
+    0x0c, 0x12, 0x12, 0x10, 0x01, 0x01, 0x08, 0x0c, 0x0c, 0x06, 0x06, 0x0c,
+    0x01, 0x04, 0x05, 0x23, 0x1d, 0x0c, 0x1e, 0x1e, 0x01, 0x07, 0x0a, 0x06,
+    0x0c, 0x09, 0x12, 0x06, 0x01, 0x04, 0x0e, 0x01, 0x0c, 0x1e, 0x1e, 0x0c,
+    0x01, 0x01, 0x01, 0x03, 0x05, 0x03, 0x08, 0x0b, 0x01, 0x01, 0x01, 0x02,
+    0x09, 0x05, 0x09, 0x0e, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x03, 0x11,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x03, 0x09, 0x09, 0x12, 0x12,
+    0x0e, 0x0b, 0x12, 0x09, 0x10, 0x06, 0x23, 0x0c, 0x09, 0x12, 0x12, 0x09,
+    0x0c, 0x09, 0x0b, 0x12, 0x0c, 0x06, 0x12, 0x0c, 0x09, 0x12, 0x12, 0x0c,
+    0x0c, 0x10, 0x0b, 0x0b, 0x06, 0x12, 0x0b, 0x0b, 0x0b, 0x0c, 0x1d, 0x1d,
+    0x0c, 0x12, 0x0c, 0x23, 0x09, 0x0b, 0x0b, 0x0b, 0x0f, 0x12, 0x12, 0x10,
+    0x10, 0x12, 0x0b, 0x0b, 0x06, 0x06, 0x0b, 0x10, 0x09, 0x0c, 0x1d, 0x1d,
+    0x06, 0x12, 0x0b, 0x12, 0x12, 0x23, 0x09, 0x09, 0x09, 0x10, 0x12, 0x1d,
+    0x0c, 0x09, 0x12, 0x0c, 0x0b, 0x0c, 0x12, 0x0b, 0x12, 0x0c, 0x0c, 0x0b,
+    0x12, 0x0b, 0x06, 0x09, 0x06, 0x0c, 0x0b, 0x0b, 0x0b, 0x06, 0x12, 0x0b,
+    0x09, 0x0b, 0x1f, 0x1d, 0x12, 0x0c, 0x12, 0x0c, 0x0e, 0x12, 0x10, 0x0b,
+    0x0c, 0x0f, 0x09, 0x12, 0x0b, 0x10, 0x09, 0x0b, 0x23, 0x0c, 0x12, 0x09,
+    0x10, 0x0b, 0x12, 0x1d, 0x09, 0x06, 0x06, 0x0b, 0x12, 0x12, 0x0c, 0x12,
+    0x0b, 0x09, 0x10, 0x09, 0x0c, 0x0c, 0x12, 0x0b, 0x0c, 0x12, 0x1f, 0x1f,
+    0x16, 0x12, 0x0c, 0x1d, 0x0b, 0x12, 0x0b, 0x06, 0x09, 0x06, 0x0c, 0x09,
+    0x1d, 0x09, 0x12, 0x12, 0x0b, 0x09, 0x0b, 0x12, 0x0b, 0x09, 0x0c, 0x06,
+    0x06, 0x23, 0x0c, 0x10, 0x0b, 0x0c, 0x0b, 0x0b, 0x12, 0x09, 0x10, 0x0b,
+    0x1d, 0x1d, 0x1d, 0x12, 0x12, 0x10, 0x0b, 0x09, 0x0c, 0x0b, 0x12, 0x09,
+    0x0c, 0x09, 0x09, 0x12, 0x0b, 0x0c, 0x12, 0x09, 0x0b, 0x10, 0x1f, 0x23,
+    0x1d, 0x09, 0x06, 0x0c, 0x0b, 0x0c, 0x09, 0x09, 0x06, 0x10, 0x0b, 0x0b,
+    0x12, 0x09, 0x12, 0x12, 0x12, 0x0c, 0x1d, 0x0c, 0x09, 0x06, 0x12, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x06, 0x1f, 0x12, 0x1d, 0x0b, 0x09, 0x09, 0x09,
+    0x06, 0x0f, 0x12, 0x12, 0x09, 0x0c, 0x1d, 0x1d, 0x0e, 0x12, 0x06, 0x0b,
+    0x06, 0x1d, 0x0b, 0x12, 0x09, 0x06, 0x0c, 0x10, 0x0c, 0x09, 0x1f, 0x12,
+    0x09, 0x0b, 0x0b, 0x1a, 0x12, 0x0c, 0x12, 0x12, 0x0c, 0x0b, 0x03, 0x06,
+    0x0c, 0x0c, 0x10, 0x0b, 0x0b, 0x06, 0x14, 0x18, 0x0b, 0x0b, 0x0c, 0x1d,
+    0x1d, 0x09, 0x0b, 0x0f, 0x23, 0x09, 0x0b, 0x0b, 0x0b, 0x12, 0x03, 0x0f,
+    0x10, 0x10, 0x12, 0x0b, 0x0b, 0x0c, 0x16, 0x18, 0x10, 0x09, 0x0c, 0x1d,
+    0x1d, 0x23, 0x0c, 0x0b, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0b, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const unsigned short map1_palette [] = {
+    0x7c1f, 0x0000, 0x1080, 0x2524, 0x1000, 0x3524, 0x35a9, 0x2480, 0x2484,
+    0x49ad, 0x3529, 0x4a4d, 0x2529, 0x4a52, 0x1084, 0x5ad2, 0x5a52, 0x49a9,
+    0x35ad, 0x7f7b, 0x5ad6, 0x7fff, 0x5a4d, 0x6f76, 0x6ed6, 0x2520, 0x6f7b,
+    0x7ffb, 0x35a4, 0x1129, 0x0084, 0x25a9, 0x3652, 0x35b2, 0x0004, 0x1124,
+    0x1089, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+};
+
+/* The tile map entry of each tile of the original image, for metagen -r. */
+#ifdef TILEGEN_REMAP
+const unsigned short map1_remap [] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0007, 0x0008,
+    0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x000e, 0x000f, 0x0010, 0x0011, 0x0012, 0x0013,
+    0x0014, 0x0015, 0x0016, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0017, 0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0022, 0x0023,
+    0x0000, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x002b, 0x0000, 0x002c,
+    0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0000,
+    0x0000, 0x0035, 0x0036, 0x0037, 0x0000, 0x0038, 0x0039, 0x003a, 0x003b,
+    0x0000, 0x003c, 0x003d, 0x003e, 0x003f, 0x0000, 0x0000, 0x0040, 0x0041,
+    0x0042, 0x0000, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0044, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0045, 0x0046, 0x0047, 0x0000, 0x0000,
+    0x0000, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x0000,
+    0x0000, 0x004f, 0x0050, 0x0051, 0x0052, 0x0000, 0x0000, 0x0053, 0x0054,
+    0x0055, 0x0000, 0x0056, 0x0057, 0x0058, 0x0059,
+};
+#endif
@@ -0,0 +1,365 @@
+/* map2.h
+ * packed by tilegen from map2.h */
+
+#define map2_width 8
+#define map2_height 1432
+#define map2_bpp 8
+
+/* LZ77 compressed by gbacomp, 11456 bytes down to 6700 */
+const unsigned int map2_data [] = {
+    0x002cc010, 0xf001013f, 0xf001f001, 0xf001f001, 0xb101f001, 0xf0020160,
+    0x0101f012, 0x03100301, 0x03020208, 0x052f0004, 0x06010605, 0x03090807,
+    0x06000b0a, 0x00080821, 0x030b010d, 0xc033f006, 0x05003a80, 0x0101090c,
+    0x0100020c, 0x02070805, 0x00090603, 0x06080d0b, 0x050e0b08, 0x080e0f00,
+    0x0a080202, 0x05083203, 0x40b038f0, 0x22300202, 0x0d0c1008, 0x07b41009,
+    0x000d0a0e, 0x03061002, 0x040a0a05, 0x0b11041c, 0xdfa036f0, 0x05033c40,
+    0x4e101240, 0x05060903, 0x02000501, 0x05050209, 0x100d020c, 0x000d0d0b,
+    0x02020c07, 0xc5008810, 0x00080506, 0x05040a19, 0x04e00080, 0x02050602,
+    0x03040307, 0x0b0b0209, 0x0409bb10, 0x000d0920, 0x0913011c, 0x00921204,
+    0x100c01f2, 0x00050907, 0x14200455, 0x02c70001, 0x0c01050c, 0x00030832,
+    0x08370029, 0x0bf10002, 0x000800ea, 0x0df50065, 0x00080700, 0x034c0f29,
+    0x15022b21, 0x32004800, 0x01601401, 0x07003500, 0x06090512, 0x0a012010,
+    0x0605a600, 0x81111016, 0x05060700, 0x0d120416, 0x00800700, 0x030d0a27,
+    0x100c0701, 0x01071020, 0x04050727, 0x17000e06, 0x0608020a, 0x040a0b04,
+    0x02100d14, 0x187b000a, 0xfaf0f40e, 0xb70001b0, 0x210c0740, 0x20050b09,
+    0x77000b05, 0x07140505, 0x09081f0d, 0xf068000c, 0x1101f001, 0x8048008d,
+    0x0204cb01, 0x060c0508, 0x06010003, 0x080d1217, 0x044c0d0e, 0x080b1d30,
+    0x77a16e50, 0x42f80201, 0x302d011f, 0x602f521e, 0x010e061f, 0x05060600,
+    0x020d0209, 0x050c0203, 0x0d010909, 0x0c09f101, 0x0d020209, 0x16005d01,
+    0x0b300202, 0x02020207, 0x040d0982, 0x00054c03, 0x000a0b57, 0x06530120,
+    0x00024206, 0x03050266, 0x07a90101, 0x0009013c, 0x009a0007, 0x0ae6013d,
+    0x10034d02, 0x000e09ee, 0x02070078, 0x11c83501, 0x087e0074, 0x05451208,
+    0x08110b0b, 0x38000405, 0x0008090d, 0x8a01e62f, 0xe8025c12, 0x8200060a,
+    0xd9123000, 0x31020710, 0x00071014, 0x00060d30, 0xb300c606, 0x0201f602,
+    0x02d5020e, 0x19420348, 0x101a1900, 0x37000609, 0x010d6812, 0x0e380217,
+    0x04054700, 0x190c0104, 0x040b050d, 0x2007000b, 0xb6010d0b, 0x02140904,
+    0x04090011, 0x11050208, 0x0b411201, 0x020d1912, 0x0204050e, 0x0206055e,
+    0x030d1905, 0x1000060c, 0x0f0d1210, 0x19019002, 0x1b200a14, 0x12ef000d,
+    0x0d110a19, 0x06a80180, 0x07110712, 0x0d500105, 0x01126f03, 0x08051546,
+    0x03064012, 0x0603157a, 0x040d0915, 0x0e030106, 0x09100008, 0x020c0602,
+    0x03080c0c, 0x04871212, 0x04100a00, 0x010c0806, 0x16160008, 0x10080b10,
+    0x05000801, 0x08090208, 0x02160112, 0x01081009, 0x4b000f09, 0x12064109,
+    0x03080a8a, 0x6300141a, 0x128911aa, 0x41122742, 0x5a431999, 0x30074b0e,
+    0x330a1507, 0x1f110a8f, 0x0f7b0100, 0x4f00b9a3, 0xf7c1d631, 0x00742203,
+    0x400a6807, 0x0b274227, 0x06032740, 0x03064602, 0x0207034e, 0x9101f801,
+    0x0303160b, 0x01d60212, 0x17028d01, 0x5901d809, 0x010d6d01, 0x01aa01e4,
+    0x06400207, 0x010ac401, 0x0c080905, 0x51000478, 0x3302c623, 0x02121c00,
+    0xe0028210, 0x040f0203, 0x0fe82116, 0x02160231, 0x04cd0039, 0x22120316,
+    0x07041205, 0x22020203, 0x00c9030a, 0x030c090c, 0x0106080b, 0x7c000c52,
+    0x01c70105, 0x18b90306, 0x01dc11d4, 0x0b0014e1, 0x19030008, 0x030c450c,
+    0x17010589, 0x03074702, 0x021640df, 0x0b0219b1, 0xa0031003, 0x020c0700,
+    0x01090315, 0x08040c0f, 0x0b0d0307, 0x050bb500, 0x02171020, 0x020b098e,
+    0x00811c0d, 0x030904da, 0x00051d0e, 0x030c04ce, 0x00081712, 0x200305de,
+    0x0d040e12, 0x17090b04, 0x010b000f, 0x090a0306, 0x08420e0a, 0x0908ec00,
+    0xc7211e0a, 0x1b020005, 0x0c140702, 0x02060314, 0x19070315, 0x07009a01,
+    0x080d000d, 0x15030119, 0x05621203, 0xef010700, 0x01060219, 0x048814a4,
+    0x09070608, 0x080a0700, 0x01076008, 0x05eb0004, 0x0c0e010a, 0x02120231,
+    0x06fe028a, 0x0700040a, 0x0e020502, 0x03040406, 0x0f4603e9, 0x0909f103,
+    0x04ca0210, 0x09440b41, 0x020f3703, 0x08860104, 0x03144a08, 0x4112053d,
+    0x09440ea9, 0x9941d515, 0x4115e751, 0xc14112c1, 0xbf920412, 0x40140710,
+    0x51c74117, 0x54e7d1cf, 0xdc074017, 0x17c49311, 0x0136050a, 0x010004ee,
+    0x02023d0e, 0x0b142b01, 0xfa01ab01, 0xada80006, 0x050b9603, 0xde030792,
+    0x00048303, 0x2e00bb1a, 0x040d0201, 0x07e01101, 0x6303c711, 0x07000854,
+    0x0bc70516, 0x030c3116, 0xaa010540, 0x16101010, 0x0400021f, 0x04100616,
+    0x1202170d, 0x00212020, 0x10012010, 0x22040715, 0x0722010d, 0x07161d03,
+    0x00100320, 0x011209f2, 0x038a1601, 0x02110249, 0x010dbb05, 0x07400cc6,
+    0x101f1e00, 0x16071706, 0x07121000, 0x100e0e07, 0x1022001f, 0x160e0d1f,
+    0x16021606, 0x161f070d, 0x0d3c0016, 0x232200a4, 0x0307d701, 0x05071a07,
+    0x09190202, 0x04070b09, 0x06000f05, 0x060d0509, 0x00160d06, 0x0a050516,
+    0x22070d0d, 0x09080e02, 0x1010220d, 0x12200c41, 0x17400010, 0x0d122207,
+    0x1f071604, 0x5b000d06, 0x06000a01, 0x01140607, 0x020d0106, 0x1208060d,
+    0x07200803, 0x000c4406, 0x08120dca, 0x05031e03, 0x020f0720, 0x03030da6,
+    0x020a1407, 0x020d0507, 0x96021e97, 0x0305080d, 0x8a020f16, 0x0a0d0203,
+    0x09030b1a, 0x0018e605, 0x0d5001b7, 0x02161902, 0x0109058a, 0x14164215,
+    0x0f0104b4, 0x05921216, 0xbb00014e, 0x07000410, 0x2613aa10, 0xba008e08,
+    0x410d030b, 0x53cf53b9, 0x41ff14ef, 0x0217d4e7, 0xf527a0bf, 0xf4dfa1d7,
+    0xa217a417, 0x2007c406, 0x1a01051c, 0x80041c22, 0x0902f703, 0x021f0610,
+    0x0402001a, 0x21212110, 0x20080402, 0x01071020, 0x06221076, 0x06440188,
+    0x58011006, 0x9004221f, 0x2010cc11, 0x070d0300, 0x16202121, 0x165c010d,
+    0x2216161a, 0x06100d05, 0xe1011610, 0x0003001a, 0x06170e17, 0x16221022,
+    0x10200600, 0x1621170e, 0x16060807, 0x0b10070e, 0x210d0e16, 0x24001f0e,
+    0x200d160d, 0x0e01c901, 0x1004100d, 0x64000607, 0x020d0d39, 0x015d0011,
+    0x00221028, 0xf601801e, 0x101a0d0d, 0x48040706, 0x070e0204, 0x0ed30117,
+    0x20002222, 0x0e0d160e, 0x500d070e, 0x1031100d, 0x0e070802, 0x08091016,
+    0x00100706, 0x00051a0c, 0x57128b18, 0x12221006, 0x41101760, 0x1f010e00,
+    0x0d160620, 0xc6001706, 0x4000076e, 0x000e6300, 0x00360051, 0x03000582,
+    0x15010e0d, 0x00070502, 0x03160d01, 0x16100c15, 0x10080301, 0x17051509,
+    0x020dc600, 0x00100e07, 0x074b02ba, 0x06515700, 0x000d8200, 0x21221081,
+    0x20208210, 0x0a822006, 0x0b120c0b, 0x040b0111, 0x05122002, 0x005c0603,
+    0x090e010f, 0x09050704, 0x0d041500, 0x07150403, 0x0b050709, 0x06060408,
+    0x00bb023d, 0x100d7182, 0x008200ba, 0x0d2310e7, 0x55f45f00, 0xa23802d7,
+    0x04177407, 0x06152020, 0x07b231ff, 0xf90730fa, 0x4901f07a, 0x328568c3,
+    0x08051f6d, 0x14f40305, 0xf0e50714, 0x86c17933, 0x0b022410, 0xe9170c09,
+    0x78061e07, 0x171f070e, 0x0603003d, 0x040e0213, 0xa4090c2c, 0xb809036f,
+    0x070d3a20, 0x2f040c40, 0x05060801, 0x08b6040c, 0x1e030843, 0x0412d503,
+    0x0eef07ee, 0x075303f4, 0x09030037, 0x070201f2, 0x03a12110, 0x1b03109c,
+    0x22211610, 0x1097fa01, 0x02040602, 0xc501205d, 0x4212e001, 0x211300ab,
+    0x01041810, 0x330022d7, 0x22ecee01, 0x01d30395, 0x1200169e, 0x10229d02,
+    0x10070718, 0x2c02ff01, 0xe9210610, 0x03000f02, 0x12177702, 0x24220679,
+    0x6700e86e, 0xc7014b00, 0x0d050404, 0x175d0d0e, 0x000d3600, 0x00d90247,
+    0x7e122138, 0x07a801aa, 0x00216224, 0x4d000431, 0x1104f70d, 0x66003e00,
+    0x00071e00, 0x5403134c, 0x00167e97, 0x04da0289, 0x1025024a, 0x0e210082,
+    0x10ca12f8, 0x02820012, 0x172c007f, 0x10f41f07, 0x0341100c, 0x057e003e,
+    0x0a079714, 0x024908d7, 0xbd0607a6, 0x00a6021f, 0x83640240, 0x16179412,
+    0x000d1f04, 0x323c0582, 0x0f001707, 0x221f8310, 0x07166600, 0x0a0c0905,
+    0x007d010b, 0x23ce0b39, 0xfb10080a, 0x031f0706, 0xc551028f, 0xba005f00,
+    0x13071a22, 0x82202186, 0x000400ca, 0x000f1f82, 0x8200241e, 0xdb048206,
+    0x0d0b0602, 0x0d980204, 0x028409bf, 0x90013956, 0x8742f631, 0x8f729648,
+    0xf2dd14fe, 0xf001f025, 0x18538201, 0x0564041b, 0x041c09df, 0xee00066a,
+    0x3632ac3a, 0x0710a809, 0x17120c78, 0xb217d206, 0x0b1a0600, 0x02013e0c,
+    0x3c024c02, 0x1408b40b, 0x7c0caf14, 0x0dec0507, 0x07100015, 0x055d092a,
+    0x9f06f10a, 0x0700b904, 0x0c0c0608, 0x396a0709, 0x88060305, 0xe81bde0b,
+    0x7a090805, 0x096c0cbf, 0x8a087908, 0xb31a0700, 0x9e08ed00, 0x012700bc,
+    0xe61afc0a, 0xde1a810a, 0x00fb0c04, 0x06100099, 0x00ed0289, 0xab090c44,
+    0x0b3d1800, 0x09cd070c, 0x061d063d, 0xcd020929, 0x01212123, 0x21042074,
+    0xb412aa12, 0x10a302b7, 0x0e00b702, 0x160d0020, 0x26bb1275, 0x0c002210,
+    0xec122004, 0xac21b612, 0x05062702, 0x1a000d57, 0x0d1a9904, 0x10141643,
+    0x04171f16, 0x1f026205, 0x0424103f, 0x055735cd, 0x556b1247, 0xff100057,
+    0x17105725, 0x63105725, 0xb4321737, 0x17170103, 0x57450447, 0x141f060d,
+    0x12a302b6, 0x3610df5f, 0x02175725, 0x2357354f, 0x022f0d7a, 0x0607083b,
+    0xef12070e, 0x28170406, 0x5715030b, 0x1f84060d, 0x02a31f07, 0x6f060944,
+    0x02171607, 0x096f000c, 0x06191707, 0x160d9704, 0x2dffc402, 0x0c000c46,
+    0xf01ef287, 0x1801f001, 0xf7de115f, 0x01f013ff, 0xe33801f0, 0x129e0b25,
+    0xef7e09b9, 0x0308ca16, 0x0402d708, 0x02770be6, 0xdbc80855, 0x610ee714,
+    0x1a3d1506, 0x070008c3, 0x1cef2e00, 0x02ab09c3, 0x040203fa, 0x0710691c,
+    0x1efca522, 0x0e07101d, 0x000e0d4e, 0x0972032d, 0xa31cb60c, 0x1e021205,
+    0x8f0a0b85, 0xdd09f30c, 0x5c00c000, 0x0a400d0b, 0x02790e82, 0x09377d00,
+    0x02571b06, 0x360009c0, 0x3e006303, 0x04090a11, 0x0b03450d, 0x64072006,
+    0x0d830c01, 0x07070201, 0x50020475, 0x06270b0d, 0x03078600, 0x0d840416,
+    0x0116036f, 0x02240310, 0x10164202, 0x05020a3a, 0x0c250016, 0x05790bd8,
+    0x1a0f0147, 0x010d4805, 0x000d5809, 0x181204e6, 0x04229301, 0x02237406,
+    0x01560261, 0x5e0216e5, 0x04290621, 0x1f9a0222, 0x071f7702, 0x12ada807,
+    0x0112073c, 0x07ee0822, 0x900404be, 0x164002bd, 0x1d057e04, 0x97078812,
+    0xed120717, 0x54029747, 0x02065725, 0x0457157a, 0x15ffd404, 0x10ab0557,
+    0x153f0210, 0x04ea1457, 0x9d97d7b4, 0x100d7f14, 0xa9156e17, 0x15175725,
+    0xba19b057, 0x0057b506, 0x150d063b, 0x00034d06, 0x1a102054, 0x173e0561,
+    0x0598040b, 0x09161f4d, 0x08d4149d, 0x01420d0a, 0x070dd502, 0xd829080a,
+    0x070e1110, 0x0a7f120a, 0x3fff1507, 0x3701f0ff, 0x14e94601, 0x0435220b,
+    0x010a203f, 0xc701bdc0, 0x0a7d1408, 0x01c706e5, 0x9c060754, 0x04e001bc,
+    0xcd0e7e00, 0xf50c2b06, 0x047d0b03, 0xf901d701, 0xec0aed0a, 0x01046f12,
+    0x9301dc8c, 0x0203f607, 0x20670e67, 0x6d0a0107, 0x062f1f04, 0x1e0d04e0,
+    0x01061d03, 0x3c1291ef, 0x8e140410, 0x04050b02, 0x8107bf77, 0x0ca4120c,
+    0x15c904ed, 0x12540c7c, 0x1001337e, 0xab100700, 0xaa201605, 0x09747a0b,
+    0x5b27f71f, 0x250aa829, 0xef010a1e, 0x4000720b, 0x0226c402, 0x07a41465,
+    0xfb3a004c, 0xa20c5d07, 0xc2008c02, 0x090cfc0e, 0x2f490de2, 0xe01b1010,
+    0x2d6d0608, 0x28ec01de, 0x8124f713, 0x7e011d12, 0x01071a02, 0x016e175b,
+    0x20223b99, 0x0120ba09, 0x0616d616, 0x7f851463, 0x098e0907, 0x11c606ac,
+    0x024807be, 0xfc573750, 0x57271e07, 0x57271902, 0x56024f00, 0x01f42016,
+    0x0bd724b5, 0x247b096c, 0x04211c17, 0x076e00ed, 0x07d71446, 0x57175a10,
+    0xf657c70d, 0xd7543b25, 0xd724b30b, 0x29d78407, 0x02820d8e, 0x060d22c5,
+    0x72171802, 0x03061016, 0x10971212, 0x420e0207, 0x10020317, 0x12190c22,
+    0x0708073e, 0x0208190c, 0x0c101fd4, 0x0a021421, 0x0c0d0d5d, 0x80660111,
+    0x0e059409, 0x07270502, 0x1108400d, 0x0f0d1957, 0x2806050e, 0xe8080c14,
+    0x01a4000f, 0x0a201419, 0x03e2001b, 0x110a1912, 0x07150700, 0x07120705,
+    0x07071211, 0x0608001a, 0x153b0712, 0x0e080503, 0x6b070b07, 0xf38eaf85,
+    0x4679c416, 0x89b92139, 0x28041001, 0x04799b5b, 0x5f04461e, 0x67028b1b,
+    0x091f0302, 0x00bb1dff, 0x01af2409, 0x06e32bd4, 0x06d7149e, 0x9702c9b8,
+    0x0d0abb24, 0x0110c306, 0x1d94e501, 0x001301b8, 0xaf040828, 0x0c210404,
+    0x213f0201, 0x00031f10, 0x1f030d07, 0x04122110, 0x00036113, 0x04200c47,
+    0xb8021606, 0x22072801, 0x8f020a62, 0x0e098809, 0x12860202, 0x0fdd04c7,
+    0x080605d1, 0xad03070b, 0x04612a01, 0x37006104, 0x04070d0e, 0x09fe682b,
+    0x11400441, 0x03bc13c0, 0x00d100db, 0x072b1627, 0x10961902, 0x03220109,
+    0xef1b109a, 0xb6015404, 0x02205444, 0x10380215, 0xf5480018, 0x08071a19,
+    0x3602b028, 0x075c1621, 0x198f3600, 0x0422079d, 0x9809e201, 0x58147f0d,
+    0x145414ff, 0x00671471, 0x34ac1982, 0x02990254, 0x7d12ff55, 0x6910b112,
+    0x8912c614, 0x6e02ae10, 0x203d8220, 0x1bd73406, 0x1c8210ec, 0x64050607,
+    0x104100fd, 0x67361282, 0x14b70217, 0xa10206be, 0x249010ff, 0x64ba00d7,
+    0x1a1200d7, 0x00d77478, 0xba20fe82, 0x4c20d503, 0x97141906, 0x111ada01,
+    0x0c0d0816, 0x65001703, 0x20021020, 0xd7141203, 0x12030c10, 0x3d01861f,
+    0x17090510, 0x2301d60c, 0x150a0002, 0x09150802, 0x1508080d, 0x00060311,
+    0x1b0d0b07, 0x14070200, 0x05040f09, 0x07030215, 0x09150219, 0x020d0700,
+    0x05190b0d, 0x5e0c1502, 0x05192106, 0x020f0f00, 0x07001206, 0x0ce403cc,
+    0x010e0696, 0x0f2714b0, 0x08070006, 0x020c050d, 0x0a000b14, 0x0707140e,
+    0x20061402, 0x0d031405, 0x020c1106, 0x1226001b, 0x02110815, 0x0b001b02,
+    0x190e1914, 0x041b090c, 0x190d1405, 0x05a90c0d, 0x2b077f0f, 0x060190b7,
+    0x050720b3, 0x42673c92, 0x9205e5b8, 0xf14b8f3c, 0x5b6c170e, 0xfcb72208,
+    0x2f059c02, 0x2f050700, 0x57059c06, 0x0bc10205, 0x09a104c2, 0x10222310,
+    0x0775231c, 0x57158a06, 0x05163601, 0xa1030a57, 0x081a164d, 0x8f021706,
+    0x031ffe0b, 0x04217ddd, 0x065d1600, 0x1ce328a3, 0x751e220c, 0x121d04c4,
+    0x21201027, 0x0d1f1900, 0x1f142079, 0xf12b8c0b, 0x04103b02, 0x00862529,
+    0x0e0e0e2a, 0x0b46041f, 0x01f5042f, 0x144b00c1, 0x0d150019, 0x120d8b01,
+    0x2507ff8c, 0xd4042600, 0xca02c201, 0xdd213700, 0x01f7d406, 0x062c2c9c,
+    0x072704a9, 0xdf04c314, 0x24f4b02b, 0x194719d4, 0x17d52eac, 0x0e079c1b,
+    0x005f14f4, 0x025e1c82, 0xba101f55, 0x1a370e1f, 0x15c40e1a, 0xc0102154,
+    0xd4248d10, 0x147519ff, 0x204507d4, 0x04340079, 0x1c5a356a, 0x82109f1f,
+    0x5f02070e, 0xda02d000, 0x761c130c, 0x0682109d, 0xd57c0010, 0x0d820057,
+    0x01bfc50c, 0x5717073d, 0xbc1c8220, 0x64076513, 0x15ffbc00, 0x154010c9,
+    0x15573595, 0x005725d1, 0x8b571526, 0x09085727, 0x0557270a, 0x53054f02,
+    0x0b020d16, 0x0d0d3f1f, 0x16ba10b7, 0x05051608, 0x0eba100a, 0x13c8050b,
+    0x0c4100df, 0x16012612, 0x14401222, 0x07088f06, 0x010d1a0c, 0x16060a08,
+    0x019e070a, 0x0c9a0d0d, 0x00080d95, 0x0b6b0c07, 0x000d9f06, 0x0c0a0812,
+    0x070b0306, 0x040b0f20, 0x0703032b, 0x0c010c14, 0x010c0d0c, 0xb3061e06,
+    0x0d070828, 0x940c070b, 0x40030d12, 0x01ad0114, 0x1b01070f, 0x19080008,
+    0x02161b01, 0x0e040815, 0x081b030a, 0x0b19fe02, 0x091b090b, 0x06080307,
+    0x86000700, 0xc5021540, 0x02080e09, 0x145e0d14, 0x420a6845, 0x050f509f,
+    0x190720c1, 0x19e24eae, 0x40176d45, 0x0cd75c27, 0x02b40960, 0xd7172271,
+    0x1c22920b, 0x2f061f8e, 0x07181f10, 0x00b20b20, 0x02e2161f, 0x030b61af,
+    0x03cf02e3, 0x0e1f080b, 0x191aca82, 0x04160d02, 0x01209a02, 0x1bff067f,
+    0x166e04d2, 0x193a0276, 0x1ec72e96, 0xfc7206d8, 0xea0d5102, 0x33041e05,
+    0x5c02862d, 0x1dff2021, 0x001915d9, 0x04850ef7, 0x1788025f, 0x1fc00b54,
+    0x041a2110, 0x169e0158, 0x150800e2, 0x68029f14, 0x14150716, 0xa7115b04,
+    0x11135904, 0x101817af, 0x02165427, 0x009c279d, 0xef280220, 0xdb292720,
+    0x15047100, 0x1797f5c3, 0x7f821054, 0x104c000d, 0x55d75782, 0x65741297,
+    0xe2831297, 0x260a97a5, 0x22076b03, 0x04d7171f, 0x19d727f1, 0x752606e4,
+    0x1a0e0797, 0x01ef97f5, 0x47973533, 0xd72720d7, 0xd7378210, 0x2ae93e15,
+    0x15dd10ad, 0x9c130797, 0x97e52121, 0x151d00de, 0xaf131993, 0xba10d000,
+    0x7f0db002, 0x10590005, 0x00fb1082, 0x20bb23c4, 0xa43d3182, 0x00209c2f,
+    0x0a0d0e9d, 0x41030f6a, 0x033b0510, 0x08010e0d, 0x0110ba02, 0x8b07070d,
+    0x08031610, 0x05091001, 0x1f100d08, 0x051e3a09, 0x8516100b, 0xae131501,
+    0xca08b400, 0x3d01c513, 0x97020309, 0x030e0305, 0x36171e64, 0x0911600c,
+    0x1a05fb0b, 0x5a080240, 0x120c1206, 0x03000e05, 0x01121709, 0x2c0f0215,
+    0xd1050903, 0x0507100d, 0x4f050ee9, 0x0f0c0a0f, 0x42e10208, 0x5fa742b7,
+    0x5f127e77, 0x92f90777, 0x1897d5cf, 0x166f0e17, 0x113f18e2, 0x061718f3,
+    0xef072121, 0x7c22c705, 0x06209715, 0x059f0d21, 0x7920006f, 0x11ef0701,
+    0x1eef1ace, 0x11212095, 0x07163f66, 0xb7054f05, 0x77058219, 0xbb01d101,
+    0x9705104f, 0xd8022106, 0xf4197717, 0x02e79715, 0x119715b6, 0x03220658,
+    0x11922928, 0x151f7fab, 0x119f1ea2, 0x0b53045d, 0x149735be, 0x9745bf63,
+    0x004e1424, 0x48978575, 0x182f0717, 0xcc02ff17, 0x97251748, 0x1425dc04,
+    0xf7145020, 0x00fed301, 0x12976531, 0x0c1738aa, 0x272a265f, 0x1a7f1094,
+    0x33006d00, 0x52269785, 0xa4309715, 0x10af9745, 0x17881f41, 0x15177807,
+    0x757f2397, 0x9b12ff97, 0x4100b902, 0x5b3f9775, 0x87051788, 0x03ff8210,
+    0x15c21815, 0x7ce51597, 0x85ef2aef, 0xe33d1197, 0x1718e312, 0x1a067a0f,
+    0x13ec101f, 0x8240ffb1, 0x721d5206, 0x8210ef13, 0x63009715, 0x11fb8402,
+    0x11bc003d, 0x10dc1d3d, 0x160310ba, 0x06ff4a11, 0x10ad3bfc, 0x0b4d118a,
+    0x02ba00d9, 0xe01110b7, 0x3d311a26, 0x0c15a902, 0x89150203, 0x13150800,
+    0x05801502, 0x80b20c15, 0x06101300, 0x150c0408, 0x160b0003, 0x02080805,
+    0x084e0119, 0x04046901, 0x5b000d0b, 0x6a044707, 0x01e71112, 0x17580832,
+    0x12c74212, 0x15914dbd, 0x97f59f42, 0x173897b5, 0xed173810, 0x1758d701,
+    0x021f9735, 0x1f9795af, 0x55b50d03, 0x97250997, 0x18161748, 0x17282017,
+    0x079e129f, 0xf5df0e06, 0x0ca82197, 0xff9785e8, 0x1798d909, 0x9417db01,
+    0x97f52a01, 0x44019775, 0x007a12f5, 0x581f2518, 0x1c070417, 0xf5173807,
+    0x45129614, 0x97d53401, 0x1f976521, 0x127fbe01, 0x1778b72a, 0x1728b100,
+    0x97a597f5, 0x03fe0e00, 0x251a060d, 0x151728d5, 0x00171841, 0x043f1765,
+    0x02971507, 0x0097a538, 0x006a1847, 0x9775e366, 0x82001728, 0x00211022,
+    0xff17288d, 0x1e008210, 0x97f5a208, 0x36239765, 0x9b122f2b, 0x21ed00bf,
+    0xa203fc00, 0xa5131738, 0x04006a01, 0x163d21b7, 0x3725dc09, 0x3661000d,
+    0xc6d5261a, 0x01109302, 0x00120616, 0x04a20128, 0x171f060f, 0x006b1920,
+    0x202a0e7d, 0x3d11ff82, 0x52168200, 0xba00f412, 0xba008220, 0x06de8220,
+    0x1a821044, 0x80005800, 0x2b1aad1e, 0x02197f07, 0x00832101, 0x00a713ba,
+    0x111a2647, 0x8210eff8, 0x3513ba10, 0x06175812, 0xca973207, 0x97f5f7e7,
+    0x97452740, 0x18041748, 0x689b0317, 0x97f5bb17, 0x0f975508, 0x04973585,
+    0xbf029705, 0x1617a89b, 0x036e0d1f, 0x9204209b, 0x05bf2211, 0x97351f97,
+    0x86057705, 0xdf199725, 0x17ff9745, 0x887e1f94, 0x01c90217, 0x1e990892,
+    0xff3a2bf2, 0xc41f6334, 0x97852b00, 0x17f84915, 0x3f13af7d, 0xa204067d,
+    0x78149755, 0x59248401, 0xf197251f, 0x1748ac01, 0x1758c004, 0x10240d1a,
+    0x9795efab, 0x79112216, 0x16970516, 0x1097454c, 0x20167f82, 0x1017a882,
+    0xf5f82745, 0x2097d597, 0x0c227f78, 0x1017c835, 0x00120070, 0x1597351c,
+    0xa02ef714, 0x0501c422, 0x88219735, 0x0e691017, 0x1738ff52, 0xed2e9755,
+    0xe70b0501, 0x851097f5, 0x00dffc22, 0x1adf2271, 0x35111748, 0x00061d16,
+    0x08229725, 0x07972512, 0x3d311905, 0x6f03d919, 0x120be526, 0x10970201,
+    0x0445080b, 0x040a0606, 0x0c72080d, 0x03093e05, 0x430dd40d, 0x61022d02,
+    0xff0c6612, 0x35552e45, 0x0120d007, 0x01f0c1fd, 0x019001f0, 0x081758b6,
+    0xd522e311, 0x22170802, 0x0b4506f3, 0x020bed22, 0x03652006, 0x30afd302,
+    0x3d5b0233, 0x1f961301, 0x171758d7, 0x1718d601, 0x01222118, 0x972521ef,
+    0x6c022702, 0x01971305, 0x54040143, 0x0d0ba00e, 0x9715026f, 0x1a1a1718,
+    0x3f17c832, 0xfe974571, 0x97255703, 0x97e51b00, 0x1728dc01, 0xfa22de11,
+    0xd926fd23, 0x17041b00, 0xb5219765, 0x224f0d97, 0x06241425, 0x17182300,
+    0xf0113010, 0x121778be, 0x8210aa02, 0x97f51425, 0xff1f9765, 0x1758a308,
+    0x17581716, 0x3a1b8113, 0x9715ba00, 0xba10047f, 0x81229715, 0x97458210,
+    0x1728f910, 0x101518ff, 0x05af5de1, 0x15821014, 0x00974514, 0x9745df40,
+    0x03162c05, 0x9882102c, 0x10402017, 0x1718f38e, 0xd2109725, 0x0e163d11,
+    0x97f53d31, 0x16172896, 0x0617381e, 0x3d216e01, 0x17147908, 0x00977516,
+    0x079715ba, 0x67974515, 0x15b20107, 0x52150797, 0x6210528f, 0x5d52f018,
+    0x3e450740, 0x080227e0, 0x13d90315, 0x025a02a8, 0x1100ad14, 0x39010206,
+    0x026d0284, 0x22070909, 0x54090187, 0x05553802, 0x50034d48, 0xe6010355,
+    0x9800c800, 0x1a045204, 0x1c01f91b, 0x071f7316, 0x161705e7, 0x031606f1,
+    0x02400857, 0x0c02160d, 0x91110508, 0x7705b303, 0x25250205, 0x32080fb9,
+    0xd7391023, 0x14079757, 0x0453101f, 0x1124710f, 0xb5e7e50c, 0x024f0117,
+    0x010d06f4, 0x19c90483, 0x6316ff52, 0x7c0fb501, 0x82009737, 0x41109424,
+    0x10df1785, 0x06173529, 0xa9261725, 0x06051417, 0x57ef9011, 0x35921297,
+    0x17551717, 0x17959404, 0x109de706, 0x00200d9b, 0x67db1688, 0x5e242197,
+    0x158210f5, 0x108e0836, 0x17751f91, 0xfd3b151a, 0x3d311795, 0xbb139717,
+    0x9737d012, 0xd9150017, 0x17351900, 0x0441110d, 0x150e0bd5, 0x100d04d2,
+    0x0509080a, 0x13051617, 0x37020a19, 0x37060d97, 0x9f891297, 0x15073d01,
+    0x8c037018, 0x3d0ddd1f, 0x050fbd01, 0x14050a08, 0x32d61435, 0xf9395233,
+    0x264a1fb2, 0x01f0df64, 0x070201f0, 0x2dc96110, 0x0207300a, 0x05373202,
+    0x1e6d2a0a, 0x07080802, 0x5272208f, 0x01854a38, 0x2b1f2eff, 0x262e1cd3,
+    0x138627d7, 0x134b277f, 0x57248251, 0x05081604, 0x06060b0a, 0x07bf0781,
+    0x02030805, 0x2fd10702, 0xd7b60202, 0x02a50416, 0x00f21c8a, 0x57848155,
+    0x10050922, 0x190e0705, 0x0d080600, 0x080a0b09, 0x050c0b07, 0x3a080302,
+    0x1d322d0c, 0x4006fe00, 0x7e008220, 0x20025a17, 0xda245744, 0x3804c122,
+    0x161a2304, 0x2f090609, 0x2603b992, 0xf6e42708, 0x10f401d7, 0xe1010221,
+    0xba101120, 0x02105734, 0x68100505, 0x09c51084, 0x0620220b, 0x68010c65,
+    0x00d71603, 0xd716033c, 0x5b0b150d, 0x102a1d01, 0xf51f6603, 0x14dc0b19,
+    0x12161057, 0x066d0b0d, 0x2904050d, 0x200f0102, 0x08441105, 0xbf914603,
+    0xc1020500, 0xf001f0cb, 0xf0f8a101, 0xcc01f040, 0x014001f0, 0xad170408,
+    0x040cec01, 0x01240426, 0x010a02ff, 0x0855109f, 0x74020566, 0x03036220,
+    0x3dd06e64, 0x05091207, 0x05141003, 0x0a713205, 0x22300b5f, 0x20294208,
+    0x8001f01c, 0xe7baf0be, 0x01f001f0, 0x00000150, 0x01f001f0, 0x508001f0,
+    0x00000001,
+};
+
+const unsigned short map2_palette [] = {
+    0x7c1f, 0x0000, 0x1080, 0x1000, 0x1084, 0x2524, 0x35a9, 0x49ad, 0x3529,
+    0x2484, 0x49a9, 0x3524, 0x2480, 0x4a4d, 0x5a52, 0x6ed6, 0x2529, 0x7f7b,
+    0x5ad2, 0x2520, 0x6f76, 0x6f7b, 0x35ad, 0x4a52, 0x6ed2, 0x5ad6, 0x5a4d,
+    0x7fff, 0x35b2, 0x3652, 0x7ffb, 0x25a9, 0x0084, 0x1124, 0x1129, 0x1089,
+    0x25ad, 0x4a49, 0x35a4, 0x7f76, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+};
+
+/* The tile map entry of each tile of the original image, for metagen -r. */
+#ifdef TILEGEN_REMAP
+const unsigned short map2_remap [] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000b, 0x000c, 0x000d, 0x000e,
+    0x000f, 0x0010, 0x0011, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019,
+    0x001a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001b,
+    0x001c, 0x001d, 0x001e, 0x001f, 0x0020, 0x0021, 0x0022, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0023, 0x0024, 0x0025, 0x0026,
+    0x0027, 0x0028, 0x0029, 0x002a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x002b, 0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033,
+    0x0034, 0x0000, 0x0000, 0x0000, 0x0000, 0x0035, 0x0036, 0x0037, 0x0038,
+    0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+    0x0046, 0x0047, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+    0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0052, 0x0053, 0x0054, 0x0055,
+    0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x005d, 0x005e, 0x005f, 0x0060, 0x0061, 0x0062, 0x0063,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0000, 0x0000, 0x0000, 0x0000, 0x0068,
+    0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071,
+    0x0072, 0x0000, 0x0000, 0x0000, 0x0000, 0x0073, 0x0074, 0x0075, 0x0076,
+    0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x007e, 0x007f, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084,
+    0x0085, 0x0086, 0x0087, 0x0088, 0x0000, 0x0000, 0x0000, 0x0000, 0x0089,
+    0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f, 0x0090, 0x0091, 0x0092,
+    0x0093, 0x0000, 0x0000, 0x0000, 0x0000, 0x0094, 0x0095, 0x0096, 0x0097,
+    0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x009e, 0x009f, 0x00a0, 0x00a1, 0x00a2, 0x00a3,
+    0x00a4, 0x00a5, 0x00a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x00a7, 0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00ad,
+    0x00ae, 0x00af, 0x00b0, 0x00b1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00b2,
+};
+#endif
@@ -0,0 +1,88 @@
+/* created by metagen from map2tile.h and map2boundary.h */
+
+#define map2meta_width 16
+#define map2meta_height 16
+#define map2meta_count 51
+
+const struct Metatile map2meta_metatiles [] = {
+    {{{0x0000, 0x0000, 0x0000, 0x0000}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x0001, 0x0002, 0x0005, 0x0006}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x0003, 0x0004, 0x0007, 0x0008}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x0000, 0x0000, 0x0009, 0x000a}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x0000, 0x000b, 0x0000, 0x0013}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x000c, 0x000d, 0x0014, 0x0015}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x000e, 0x000f, 0x0016, 0x0017}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x0010, 0x0011, 0x0018, 0x0019}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x0012, 0x0000, 0x001a, 0x0000}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x0000, 0x001b, 0x0000, 0x0023}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x001c, 0x001d, 0x0024, 0x0025}, {0x00b2, 0x001d, 0x00b2, 0x0025}}},
+    {{{0x001e, 0x001f, 0x0026, 0x0027}, {0x001e, 0x001f, 0x0026, 0x0027}}},
+    {{{0x0020, 0x0021, 0x0028, 0x0029}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x0022, 0x0000, 0x002a, 0x0000}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x0000, 0x002b, 0x0035, 0x0036}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x002c, 0x002d, 0x0037, 0x0038}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x002e, 0x002f, 0x0039, 0x003a}, {0x002e, 0x002f, 0x0039, 0x003a}}},
+    {{{0x0030, 0x0031, 0x003b, 0x003c}, {0x0030, 0x0031, 0x003b, 0x003c}}},
+    {{{0x0032, 0x0033, 0x003d, 0x003e}, {0x0032, 0x0033, 0x00b2, 0x00b2}}},
+    {{{0x0034, 0x0000, 0x0000, 0x0000}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x003f, 0x0040, 0x0048, 0x0049}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x0041, 0x0042, 0x004a, 0x004b}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x0043, 0x0044, 0x004c, 0x004d}, {0x0043, 0x0044, 0x0033, 0x0033}}},
+    {{{0x0045, 0x0046, 0x004e, 0x004f}, {0x0045, 0x0046, 0x0033, 0x0033}}},
+    {{{0x0047, 0x0000, 0x0050, 0x0051}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x0052, 0x0053, 0x005d, 0x005e}, {0x00b2, 0x00b2, 0x00b2, 0x005e}}},
+    {{{0x0054, 0x0055, 0x005f, 0x0060}, {0x0054, 0x0055, 0x005f, 0x0060}}},
+    {{{0x0056, 0x0057, 0x0061, 0x0062}, {0x0056, 0x0057, 0x0061, 0x0062}}},
+    {{{0x0059, 0x0059, 0x0063, 0x0064}, {0x0058, 0x0059, 0x0063, 0x0064}}},
+    {{{0x005a, 0x005b, 0x0065, 0x0066}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x005c, 0x0000, 0x0067, 0x0000}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x0068, 0x0069, 0x0073, 0x0074}, {0x00b2, 0x0069, 0x00b2, 0x0074}}},
+    {{{0x006a, 0x006b, 0x0075, 0x0076}, {0x006a, 0x006b, 0x0075, 0x0076}}},
+    {{{0x006c, 0x006d, 0x0077, 0x0078}, {0x006c, 0x006d, 0x0077, 0x0078}}},
+    {{{0x006e, 0x006f, 0x0079, 0x007a}, {0x006e, 0x006f, 0x0079, 0x007a}}},
+    {{{0x0070, 0x0071, 0x007b, 0x007c}, {0x00b2, 0x00b2, 0x007b, 0x00b2}}},
+    {{{0x0072, 0x0000, 0x007d, 0x0000}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x007e, 0x007f, 0x0089, 0x008a}, {0x00b2, 0x007f, 0x00b2, 0x008a}}},
+    {{{0x0080, 0x0081, 0x008b, 0x008c}, {0x0080, 0x0081, 0x008b, 0x008c}}},
+    {{{0x0082, 0x0083, 0x008d, 0x008e}, {0x0082, 0x0083, 0x008d, 0x008e}}},
+    {{{0x0084, 0x0085, 0x008f, 0x0090}, {0x0084, 0x0085, 0x008f, 0x0090}}},
+    {{{0x0086, 0x0087, 0x0091, 0x0092}, {0x0086, 0x0087, 0x0091, 0x00b2}}},
+    {{{0x0088, 0x0000, 0x0093, 0x0000}, {0x00b2, 0x00b2, 0x00b2, 0x00b2}}},
+    {{{0x0094, 0x0095, 0x0000, 0x009e}, {0x00b2, 0x0095, 0x00b2, 0x00b2}}},
+    {{{0x0096, 0x0097, 0x009f, 0x009f}, {0x0096, 0x0097, 0x009f, 0x00a0}}},
+    {{{0x0098, 0x0099, 0x00a1, 0x00a2}, {0x0098, 0x0099, 0x00a1, 0x00a2}}},
+    {{{0x009a, 0x009b, 0x00a3, 0x00a4}, {0x009a, 0x009b, 0x00a3, 0x00a4}}},
+    {{{0x009c, 0x009d, 0x00a5, 0x00a6}, {0x009c, 0x00b2, 0x00a5, 0x00b2}}},
+    {{{0x00a7, 0x00a8, 0x0000, 0x00ad}, {0x00b2, 0x00a8, 0x00b2, 0x00b2}}},
+    {{{0x00a9, 0x00aa, 0x00ae, 0x00af}, {0x00a9, 0x00aa, 0x00b2, 0x00af}}},
+    {{{0x00ab, 0x00ac, 0x00b0, 0x00b1}, {0x00ab, 0x00ac, 0x00b0, 0x00b2}}},
+};
+
+const unsigned char map2meta_collision [] = {
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x11, 0x00,
+    0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x00, 0x00,
+    0x55, 0x15, 0x00, 0x00, 0x00, 0x55, 0x55, 0x11, 0x00, 0x00, 0x00, 0x45,
+    0x55, 0x11, 0x00, 0x00, 0x00, 0x40, 0x55, 0x51, 0x00, 0x00, 0x00, 0x44,
+    0x51, 0x90, 0x40,
+};
+
+const unsigned char map2meta_map [] = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   1,   2,   3,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   4,   5,   6,   7,   8,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   9,  10,  11,  12,  13,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,  14,  15,  16,  17,  18,  19,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,  20,  21,  22,  23,  24,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,  25,  26,  27,  28,  29,  30,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,  31,  32,  33,  34,  35,  36,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,  37,  38,  39,  40,  41,  42,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,  43,  44,  45,  46,  47,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,  48,  49,  50,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+const struct MetatileMap map2meta = {map2meta_metatiles, map2meta_collision, map2meta_map, 16, 16};
@@ -0,0 +1,1039 @@
+/* map2.h
+ * packed by tilegen from map2.h */
+
+#define map2_width 8
+#define map2_height 1432
+#define map2_bpp 8
+
+const unsigned char map2_data [] = {
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x02, 0x02, 0x03, 0x04, 0x02,
+    0x01, 0x01, 0x05, 0x05, 0x06, 0x06, 0x07, 0x08, 0x09, 0x03, 0x0a, 0x0b,
+    0x06, 0x07, 0x08, 0x08, 0x08, 0x05, 0x06, 0x06, 0x01, 0x0b, 0x03, 0x06,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x0c, 0x09, 0x01, 0x01,
+    0x0c, 0x02, 0x01, 0x05, 0x08, 0x07, 0x02, 0x03, 0x06, 0x09, 0x0b, 0x0d,
+    0x08, 0x06, 0x08, 0x0b, 0x0e, 0x05, 0x0f, 0x0e, 0x08, 0x02, 0x02, 0x08,
+    0x0a, 0x03, 0x08, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x0c, 0x0d, 0x09,
+    0x02, 0x01, 0x01, 0x01, 0x07, 0x0e, 0x0a, 0x0d, 0x02, 0x10, 0x06, 0x03,
+    0x05, 0x0a, 0x0a, 0x04, 0x04, 0x11, 0x0b, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x05, 0x12,
+    0x01, 0x03, 0x01, 0x01, 0x03, 0x09, 0x06, 0x05, 0x01, 0x05, 0x02, 0x09,
+    0x02, 0x05, 0x05, 0x0c, 0x02, 0x0d, 0x0b, 0x0d, 0x0d, 0x05, 0x05, 0x0c,
+    0x0c, 0x02, 0x02, 0x10, 0x03, 0x06, 0x01, 0x06, 0x05, 0x08, 0x01, 0x05,
+    0x02, 0x0a, 0x04, 0x05, 0x08, 0x09, 0x03, 0x04, 0x02, 0x06, 0x05, 0x02,
+    0x07, 0x03, 0x03, 0x09, 0x02, 0x0b, 0x0b, 0x01, 0x0c, 0x02, 0x01, 0x09,
+    0x04, 0x09, 0x0d, 0x01, 0x05, 0x02, 0x01, 0x13, 0x09, 0x04, 0x12, 0x01,
+    0x0b, 0x03, 0x01, 0x0c, 0x09, 0x04, 0x12, 0x01, 0x09, 0x05, 0x01, 0x03,
+    0x05, 0x04, 0x14, 0x01, 0x08, 0x02, 0x02, 0x02, 0x0c, 0x05, 0x01, 0x0c,
+    0x08, 0x03, 0x0c, 0x02, 0x01, 0x06, 0x05, 0x02, 0x08, 0x02, 0x0c, 0x09,
+    0x01, 0x0b, 0x06, 0x05, 0x02, 0x09, 0x02, 0x05, 0x01, 0x05, 0x08, 0x0d,
+    0x02, 0x09, 0x02, 0x08, 0x01, 0x03, 0x05, 0x0f, 0x03, 0x0b, 0x03, 0x06,
+    0x01, 0x01, 0x02, 0x15, 0x01, 0x05, 0x02, 0x08, 0x02, 0x02, 0x01, 0x14,
+    0x01, 0x02, 0x0c, 0x05, 0x02, 0x02, 0x01, 0x12, 0x05, 0x09, 0x06, 0x10,
+    0x01, 0x0a, 0x05, 0x01, 0x01, 0x05, 0x06, 0x16, 0x10, 0x11, 0x05, 0x01,
+    0x01, 0x06, 0x05, 0x16, 0x04, 0x12, 0x0d, 0x01, 0x01, 0x06, 0x02, 0x08,
+    0x02, 0x0a, 0x0d, 0x03, 0x01, 0x07, 0x0c, 0x10, 0x10, 0x07, 0x08, 0x05,
+    0x01, 0x07, 0x05, 0x04, 0x06, 0x0e, 0x17, 0x0a, 0x02, 0x08, 0x06, 0x04,
+    0x0b, 0x0a, 0x14, 0x0d, 0x10, 0x02, 0x0a, 0x01, 0x08, 0x02, 0x18, 0x0e,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x02, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x05, 0x02, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x03,
+    0x0b, 0x05, 0x05, 0x0b, 0x02, 0x02, 0x01, 0x05, 0x05, 0x14, 0x07, 0x0d,
+    0x08, 0x09, 0x0c, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x01,
+    0x01, 0x09, 0x01, 0x01, 0x04, 0x02, 0x08, 0x05, 0x0c, 0x06, 0x03, 0x01,
+    0x06, 0x17, 0x12, 0x0d, 0x08, 0x0e, 0x0d, 0x04, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x0b, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x05, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x05,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x06,
+    0x06, 0x0e, 0x01, 0x06, 0x06, 0x05, 0x09, 0x02, 0x0d, 0x02, 0x03, 0x0c,
+    0x05, 0x09, 0x09, 0x01, 0x0d, 0x01, 0x02, 0x02, 0x09, 0x09, 0x02, 0x02,
+    0x0d, 0x03, 0x05, 0x04, 0x05, 0x09, 0x02, 0x02, 0x02, 0x0b, 0x07, 0x02,
+    0x02, 0x05, 0x02, 0x02, 0x03, 0x09, 0x0d, 0x04, 0x03, 0x05, 0x02, 0x05,
+    0x01, 0x0b, 0x0a, 0x02, 0x02, 0x09, 0x02, 0x08, 0x01, 0x06, 0x06, 0x02,
+    0x01, 0x02, 0x05, 0x02, 0x05, 0x03, 0x01, 0x03, 0x03, 0x09, 0x07, 0x01,
+    0x09, 0x03, 0x01, 0x03, 0x02, 0x08, 0x05, 0x01, 0x02, 0x02, 0x01, 0x03,
+    0x09, 0x0a, 0x02, 0x03, 0x02, 0x0c, 0x01, 0x01, 0x09, 0x0e, 0x01, 0x09,
+    0x05, 0x0c, 0x01, 0x01, 0x02, 0x0a, 0x02, 0x08, 0x08, 0x02, 0x02, 0x01,
+    0x01, 0x05, 0x06, 0x08, 0x08, 0x09, 0x02, 0x01, 0x01, 0x05, 0x0b, 0x0b,
+    0x08, 0x05, 0x04, 0x01, 0x03, 0x03, 0x0d, 0x09, 0x08, 0x02, 0x01, 0x03,
+    0x02, 0x0c, 0x05, 0x0d, 0x09, 0x02, 0x01, 0x03, 0x02, 0x02, 0x0a, 0x06,
+    0x09, 0x09, 0x01, 0x01, 0x01, 0x02, 0x12, 0x06, 0x09, 0x09, 0x01, 0x03,
+    0x01, 0x01, 0x14, 0x06, 0x09, 0x09, 0x01, 0x02, 0x01, 0x01, 0x0d, 0x06,
+    0x09, 0x01, 0x02, 0x05, 0x01, 0x01, 0x08, 0x08, 0x05, 0x01, 0x02, 0x0e,
+    0x01, 0x03, 0x0c, 0x06, 0x05, 0x01, 0x03, 0x19, 0x01, 0x02, 0x01, 0x1a,
+    0x10, 0x09, 0x06, 0x03, 0x02, 0x02, 0x12, 0x0d, 0x04, 0x02, 0x08, 0x03,
+    0x04, 0x02, 0x0e, 0x0d, 0x09, 0x02, 0x05, 0x04, 0x04, 0x0c, 0x19, 0x0d,
+    0x05, 0x0b, 0x04, 0x0b, 0x04, 0x0c, 0x19, 0x0b, 0x0d, 0x05, 0x04, 0x06,
+    0x04, 0x09, 0x14, 0x02, 0x11, 0x09, 0x04, 0x08, 0x02, 0x05, 0x11, 0x01,
+    0x12, 0x0b, 0x02, 0x09, 0x02, 0x05, 0x0d, 0x02, 0x0e, 0x05, 0x04, 0x02,
+    0x0b, 0x0b, 0x06, 0x02, 0x05, 0x19, 0x0d, 0x0f, 0x0e, 0x08, 0x06, 0x0d,
+    0x02, 0x0e, 0x12, 0x0d, 0x0f, 0x0d, 0x05, 0x05, 0x01, 0x19, 0x14, 0x0a,
+    0x1b, 0x0d, 0x02, 0x02, 0x03, 0x12, 0x19, 0x0a, 0x11, 0x0d, 0x02, 0x01,
+    0x05, 0x06, 0x12, 0x07, 0x11, 0x07, 0x05, 0x01, 0x0d, 0x05, 0x06, 0x06,
+    0x12, 0x09, 0x05, 0x01, 0x15, 0x05, 0x08, 0x12, 0x06, 0x06, 0x06, 0x01,
+    0x15, 0x03, 0x06, 0x15, 0x09, 0x0d, 0x06, 0x01, 0x03, 0x0e, 0x08, 0x08,
+    0x12, 0x06, 0x09, 0x02, 0x0c, 0x02, 0x0c, 0x0c, 0x08, 0x0a, 0x04, 0x04,
+    0x08, 0x03, 0x0c, 0x02, 0x04, 0x0a, 0x10, 0x04, 0x06, 0x08, 0x0c, 0x01,
+    0x08, 0x16, 0x16, 0x10, 0x0b, 0x08, 0x10, 0x01, 0x08, 0x05, 0x08, 0x02,
+    0x09, 0x08, 0x12, 0x01, 0x16, 0x09, 0x10, 0x08, 0x01, 0x09, 0x0f, 0x01,
+    0x0d, 0x05, 0x09, 0x06, 0x01, 0x02, 0x15, 0x01, 0x0a, 0x08, 0x03, 0x1a,
+    0x14, 0x0d, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x12, 0x02, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x12, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x19, 0x0b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0e, 0x07, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x15, 0x0a, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x0a, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0f, 0x05, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x06,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x05, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x0c,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x0a, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x09, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0b, 0x05,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x06, 0x02, 0x06, 0x0c, 0x09,
+    0x04, 0x03, 0x07, 0x02, 0x01, 0x0d, 0x01, 0x05, 0x04, 0x01, 0x0b, 0x03,
+    0x03, 0x12, 0x01, 0x08, 0x02, 0x01, 0x09, 0x02, 0x01, 0x0e, 0x01, 0x06,
+    0x09, 0x03, 0x02, 0x02, 0x02, 0x0e, 0x01, 0x0d, 0x02, 0x05, 0x03, 0x03,
+    0x03, 0x0d, 0x01, 0x07, 0x02, 0x06, 0x02, 0x02, 0x01, 0x0a, 0x01, 0x05,
+    0x09, 0x08, 0x0c, 0x04, 0x03, 0x0a, 0x01, 0x02, 0x05, 0x05, 0x0c, 0x02,
+    0x05, 0x09, 0x09, 0x03, 0x03, 0x03, 0x12, 0x02, 0x10, 0x05, 0x02, 0x0c,
+    0x03, 0x02, 0x0f, 0x04, 0x16, 0x08, 0x02, 0x02, 0x01, 0x01, 0x0f, 0x02,
+    0x16, 0x02, 0x02, 0x0b, 0x01, 0x01, 0x12, 0x04, 0x16, 0x03, 0x02, 0x05,
+    0x03, 0x01, 0x12, 0x04, 0x07, 0x03, 0x02, 0x09, 0x03, 0x01, 0x0a, 0x09,
+    0x0d, 0x01, 0x0c, 0x09, 0x0c, 0x03, 0x0b, 0x08, 0x06, 0x01, 0x0c, 0x03,
+    0x06, 0x02, 0x05, 0x06, 0x05, 0x01, 0x01, 0x06, 0x0c, 0x02, 0x01, 0x18,
+    0x05, 0x01, 0x01, 0x08, 0x02, 0x05, 0x01, 0x14, 0x0c, 0x02, 0x01, 0x08,
+    0x0c, 0x02, 0x01, 0x19, 0x0c, 0x0c, 0x01, 0x06, 0x05, 0x05, 0x01, 0x17,
+    0x02, 0x0c, 0x01, 0x07, 0x0c, 0x05, 0x01, 0x16, 0x01, 0x05, 0x01, 0x19,
+    0x02, 0x0b, 0x03, 0x10, 0x03, 0x05, 0x01, 0x19, 0x0c, 0x06, 0x09, 0x09,
+    0x03, 0x09, 0x01, 0x0f, 0x0c, 0x08, 0x07, 0x03, 0x0d, 0x0b, 0x04, 0x01,
+    0x0b, 0x0b, 0x05, 0x10, 0x17, 0x06, 0x02, 0x01, 0x09, 0x0b, 0x02, 0x0d,
+    0x1c, 0x0b, 0x05, 0x01, 0x04, 0x09, 0x03, 0x0e, 0x1d, 0x05, 0x05, 0x04,
+    0x01, 0x0c, 0x03, 0x12, 0x17, 0x08, 0x09, 0x04, 0x03, 0x05, 0x03, 0x12,
+    0x0e, 0x05, 0x01, 0x05, 0x04, 0x0b, 0x09, 0x17, 0x0f, 0x0b, 0x01, 0x06,
+    0x03, 0x0a, 0x09, 0x0a, 0x0e, 0x08, 0x01, 0x0b, 0x03, 0x08, 0x09, 0x0a,
+    0x1e, 0x03, 0x06, 0x15, 0x09, 0x0d, 0x05, 0x02, 0x1b, 0x02, 0x07, 0x14,
+    0x0c, 0x14, 0x03, 0x02, 0x15, 0x03, 0x07, 0x19, 0x02, 0x15, 0x01, 0x02,
+    0x15, 0x03, 0x0d, 0x0d, 0x08, 0x19, 0x01, 0x03, 0x15, 0x03, 0x12, 0x05,
+    0x08, 0x19, 0x01, 0x01, 0x15, 0x03, 0x19, 0x02, 0x06, 0x12, 0x02, 0x01,
+    0x14, 0x01, 0x07, 0x05, 0x06, 0x07, 0x09, 0x01, 0x14, 0x01, 0x0a, 0x08,
+    0x08, 0x07, 0x0a, 0x01, 0x02, 0x01, 0x0f, 0x02, 0x05, 0x0a, 0x01, 0x0e,
+    0x0c, 0x02, 0x12, 0x10, 0x09, 0x06, 0x01, 0x02, 0x02, 0x06, 0x0a, 0x04,
+    0x09, 0x06, 0x01, 0x05, 0x02, 0x0e, 0x06, 0x04, 0x04, 0x0b, 0x02, 0x02,
+    0x03, 0x0f, 0x0b, 0x05, 0x05, 0x09, 0x09, 0x10, 0x01, 0x14, 0x06, 0x07,
+    0x05, 0x04, 0x0b, 0x09, 0x01, 0x06, 0x06, 0x0f, 0x02, 0x04, 0x08, 0x01,
+    0x01, 0x08, 0x08, 0x14, 0x05, 0x02, 0x05, 0x05, 0x12, 0x06, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x0e, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x15, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0a, 0x09, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x15, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x12, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x12, 0x0d, 0x03, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x14, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x05, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x03, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x08,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0b, 0x08, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x0b,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x09, 0x05, 0x01, 0x0a, 0x02, 0x01, 0x06, 0x09, 0x02, 0x01,
+    0x02, 0x0d, 0x02, 0x01, 0x0e, 0x02, 0x02, 0x04, 0x03, 0x05, 0x09, 0x02,
+    0x0d, 0x02, 0x02, 0x09, 0x03, 0x02, 0x02, 0x02, 0x06, 0x02, 0x04, 0x08,
+    0x02, 0x01, 0x03, 0x0b, 0x09, 0x03, 0x04, 0x07, 0x03, 0x01, 0x03, 0x06,
+    0x09, 0x01, 0x04, 0x0d, 0x02, 0x02, 0x01, 0x06, 0x09, 0x01, 0x03, 0x0d,
+    0x01, 0x08, 0x01, 0x06, 0x0b, 0x01, 0x01, 0x12, 0x07, 0x01, 0x0c, 0x03,
+    0x06, 0x05, 0x04, 0x06, 0x08, 0x01, 0x0c, 0x03, 0x16, 0x06, 0x01, 0x06,
+    0x0b, 0x01, 0x02, 0x02, 0x05, 0x0c, 0x03, 0x05, 0x0b, 0x03, 0x10, 0x10,
+    0x10, 0x10, 0x16, 0x1f, 0x02, 0x04, 0x16, 0x06, 0x10, 0x04, 0x0d, 0x17,
+    0x02, 0x20, 0x20, 0x21, 0x10, 0x10, 0x10, 0x20, 0x01, 0x10, 0x10, 0x10,
+    0x16, 0x07, 0x22, 0x0d, 0x01, 0x22, 0x07, 0x16, 0x16, 0x10, 0x16, 0x07,
+    0x03, 0x10, 0x01, 0x15, 0x05, 0x09, 0x12, 0x01, 0x01, 0x16, 0x03, 0x0e,
+    0x08, 0x02, 0x11, 0x02, 0x01, 0x0b, 0x06, 0x0d, 0x0b, 0x02, 0x0d, 0x0c,
+    0x07, 0x07, 0x16, 0x16, 0x1f, 0x10, 0x06, 0x17, 0x07, 0x16, 0x10, 0x12,
+    0x07, 0x07, 0x0e, 0x0e, 0x10, 0x1f, 0x22, 0x10, 0x1f, 0x0d, 0x0e, 0x16,
+    0x06, 0x16, 0x16, 0x0d, 0x07, 0x1f, 0x16, 0x16, 0x16, 0x16, 0x10, 0x0d,
+    0x07, 0x16, 0x16, 0x23, 0x0e, 0x05, 0x01, 0x07, 0x03, 0x05, 0x05, 0x06,
+    0x07, 0x05, 0x02, 0x19, 0x09, 0x09, 0x0b, 0x07, 0x08, 0x03, 0x04, 0x0f,
+    0x06, 0x09, 0x05, 0x0d, 0x06, 0x06, 0x0d, 0x16, 0x16, 0x05, 0x05, 0x0a,
+    0x0d, 0x0d, 0x07, 0x22, 0x0e, 0x08, 0x09, 0x0d, 0x22, 0x10, 0x10, 0x1f,
+    0x22, 0x10, 0x0c, 0x12, 0x10, 0x06, 0x16, 0x16, 0x17, 0x07, 0x22, 0x12,
+    0x0d, 0x16, 0x07, 0x1f, 0x06, 0x0d, 0x10, 0x12, 0x07, 0x01, 0x0a, 0x06,
+    0x07, 0x06, 0x14, 0x01, 0x06, 0x01, 0x0d, 0x0d, 0x06, 0x08, 0x12, 0x03,
+    0x08, 0x01, 0x0d, 0x0d, 0x06, 0x08, 0x06, 0x0c, 0x06, 0x01, 0x06, 0x0d,
+    0x12, 0x08, 0x06, 0x02, 0x06, 0x03, 0x05, 0x07, 0x0f, 0x05, 0x06, 0x05,
+    0x0d, 0x03, 0x03, 0x07, 0x14, 0x02, 0x07, 0x05, 0x0d, 0x0c, 0x01, 0x06,
+    0x1e, 0x01, 0x17, 0x02, 0x0d, 0x05, 0x03, 0x16, 0x0f, 0x01, 0x19, 0x0c,
+    0x03, 0x02, 0x0d, 0x1a, 0x0b, 0x03, 0x09, 0x05, 0x02, 0x01, 0x18, 0x0d,
+    0x0b, 0x02, 0x01, 0x0d, 0x09, 0x01, 0x14, 0x16, 0x06, 0x02, 0x01, 0x05,
+    0x09, 0x01, 0x15, 0x16, 0x06, 0x09, 0x01, 0x02, 0x04, 0x01, 0x0f, 0x16,
+    0x0b, 0x05, 0x01, 0x04, 0x05, 0x01, 0x0e, 0x16, 0x06, 0x10, 0x04, 0x04,
+    0x05, 0x01, 0x06, 0x07, 0x05, 0x02, 0x04, 0x16, 0x08, 0x02, 0x08, 0x0e,
+    0x05, 0x01, 0x0b, 0x03, 0x0d, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x0f, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0e, 0x07, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x14, 0x0d, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x12, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x12, 0x05, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x0f, 0x0b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x0e, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x05, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x09, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x05,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x03, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x0a,
+    0x01, 0x07, 0x01, 0x05, 0x05, 0x01, 0x01, 0x05, 0x01, 0x1a, 0x01, 0x02,
+    0x0b, 0x01, 0x01, 0x04, 0x01, 0x0e, 0x01, 0x02, 0x09, 0x10, 0x06, 0x1f,
+    0x02, 0x1a, 0x02, 0x04, 0x10, 0x21, 0x21, 0x21, 0x02, 0x04, 0x20, 0x20,
+    0x10, 0x07, 0x16, 0x06, 0x16, 0x10, 0x22, 0x06, 0x0d, 0x22, 0x10, 0x06,
+    0x06, 0x10, 0x06, 0x0d, 0x16, 0x1f, 0x22, 0x04, 0x21, 0x10, 0x10, 0x10,
+    0x10, 0x20, 0x10, 0x10, 0x10, 0x0d, 0x07, 0x21, 0x21, 0x16, 0x0d, 0x10,
+    0x1f, 0x22, 0x16, 0x1a, 0x16, 0x16, 0x22, 0x0d, 0x10, 0x06, 0x10, 0x16,
+    0x10, 0x10, 0x16, 0x1a, 0x10, 0x10, 0x16, 0x17, 0x0e, 0x17, 0x06, 0x22,
+    0x10, 0x22, 0x16, 0x06, 0x20, 0x10, 0x0e, 0x17, 0x21, 0x16, 0x07, 0x06,
+    0x16, 0x0e, 0x07, 0x06, 0x20, 0x10, 0x0e, 0x16, 0x0e, 0x0d, 0x0e, 0x1f,
+    0x16, 0x10, 0x10, 0x0d, 0x16, 0x0d, 0x20, 0x1f, 0x16, 0x16, 0x0e, 0x0d,
+    0x10, 0x04, 0x10, 0x07, 0x06, 0x10, 0x07, 0x16, 0x0d, 0x0d, 0x16, 0x10,
+    0x16, 0x0d, 0x16, 0x1f, 0x16, 0x06, 0x10, 0x10, 0x22, 0x10, 0x0d, 0x16,
+    0x07, 0x0e, 0x0e, 0x0d, 0x0d, 0x1a, 0x10, 0x06, 0x07, 0x04, 0x04, 0x07,
+    0x07, 0x16, 0x07, 0x17, 0x06, 0x06, 0x0d, 0x0e, 0x22, 0x22, 0x20, 0x0e,
+    0x16, 0x0d, 0x0e, 0x0e, 0x07, 0x0d, 0x0d, 0x10, 0x07, 0x16, 0x0d, 0x10,
+    0x16, 0x16, 0x16, 0x07, 0x0e, 0x16, 0x10, 0x08, 0x06, 0x07, 0x10, 0x0d,
+    0x10, 0x16, 0x1a, 0x05, 0x0e, 0x07, 0x0d, 0x16, 0x16, 0x10, 0x16, 0x06,
+    0x10, 0x22, 0x22, 0x07, 0x16, 0x16, 0x17, 0x0e, 0x0e, 0x0d, 0x0d, 0x16,
+    0x10, 0x16, 0x1f, 0x20, 0x06, 0x16, 0x0d, 0x06, 0x17, 0x16, 0x06, 0x16,
+    0x07, 0x22, 0x22, 0x20, 0x16, 0x0d, 0x16, 0x0e, 0x04, 0x07, 0x07, 0x0e,
+    0x16, 0x10, 0x0d, 0x16, 0x0d, 0x05, 0x03, 0x0d, 0x0e, 0x01, 0x15, 0x02,
+    0x05, 0x07, 0x01, 0x0d, 0x16, 0x03, 0x15, 0x0c, 0x10, 0x16, 0x03, 0x08,
+    0x10, 0x09, 0x15, 0x05, 0x17, 0x10, 0x16, 0x10, 0x02, 0x07, 0x0e, 0x10,
+    0x10, 0x0e, 0x17, 0x0d, 0x06, 0x06, 0x07, 0x05, 0x0e, 0x07, 0x06, 0x07,
+    0x16, 0x07, 0x0d, 0x06, 0x0d, 0x0e, 0x10, 0x22, 0x21, 0x20, 0x0e, 0x16,
+    0x0d, 0x20, 0x06, 0x07, 0x0d, 0x0d, 0x10, 0x07, 0x0a, 0x0b, 0x0c, 0x12,
+    0x0b, 0x01, 0x0b, 0x04, 0x05, 0x0d, 0x03, 0x12, 0x05, 0x03, 0x0b, 0x02,
+    0x09, 0x0f, 0x01, 0x0e, 0x09, 0x04, 0x07, 0x05, 0x09, 0x15, 0x04, 0x0d,
+    0x03, 0x04, 0x15, 0x07, 0x09, 0x05, 0x0b, 0x08, 0x04, 0x06, 0x0d, 0x05,
+    0x06, 0x0d, 0x0e, 0x16, 0x16, 0x0d, 0x06, 0x0d, 0x0d, 0x0e, 0x0e, 0x07,
+    0x22, 0x22, 0x20, 0x10, 0x16, 0x0d, 0x10, 0x23, 0x0d, 0x07, 0x0e, 0x10,
+    0x15, 0x0a, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0d, 0x09, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x0f, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x12, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0e, 0x0d, 0x04, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x15, 0x06, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x06, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x0b, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x02, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x03, 0x0d, 0x05, 0x01, 0x01, 0x01, 0x05, 0x08, 0x05, 0x0a, 0x02,
+    0x01, 0x01, 0x01, 0x01, 0x08, 0x02, 0x0d, 0x03, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01,
+    0x02, 0x01, 0x01, 0x01, 0x02, 0x0b, 0x09, 0x0c, 0x06, 0x02, 0x01, 0x02,
+    0x0e, 0x12, 0x0d, 0x06, 0x0e, 0x0d, 0x05, 0x05, 0x02, 0x09, 0x02, 0x05,
+    0x02, 0x09, 0x02, 0x0d, 0x02, 0x05, 0x02, 0x0e, 0x04, 0x0c, 0x09, 0x0a,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x08, 0x01, 0x01, 0x01, 0x01,
+    0x03, 0x02, 0x06, 0x05, 0x01, 0x01, 0x01, 0x01, 0x02, 0x0d, 0x07, 0x0c,
+    0x03, 0x01, 0x03, 0x01, 0x08, 0x06, 0x05, 0x0c, 0x04, 0x09, 0x02, 0x02,
+    0x08, 0x09, 0x05, 0x02, 0x06, 0x0d, 0x0b, 0x12, 0x02, 0x05, 0x05, 0x09,
+    0x08, 0x02, 0x0e, 0x02, 0x06, 0x03, 0x06, 0x01, 0x03, 0x03, 0x06, 0x01,
+    0x08, 0x01, 0x05, 0x01, 0x16, 0x10, 0x10, 0x10, 0x21, 0x22, 0x10, 0x10,
+    0x10, 0x10, 0x04, 0x04, 0x10, 0x16, 0x21, 0x22, 0x06, 0x10, 0x10, 0x06,
+    0x10, 0x10, 0x06, 0x06, 0x04, 0x10, 0x10, 0x20, 0x20, 0x06, 0x10, 0x22,
+    0x10, 0x16, 0x16, 0x10, 0x22, 0x16, 0x06, 0x06, 0x10, 0x10, 0x21, 0x10,
+    0x06, 0x10, 0x10, 0x04, 0x10, 0x22, 0x22, 0x22, 0x16, 0x10, 0x10, 0x06,
+    0x07, 0x10, 0x10, 0x07, 0x16, 0x06, 0x16, 0x1f, 0x22, 0x10, 0x0d, 0x06,
+    0x06, 0x16, 0x22, 0x16, 0x10, 0x06, 0x0d, 0x22, 0x22, 0x10, 0x07, 0x07,
+    0x10, 0x07, 0x0d, 0x16, 0x07, 0x07, 0x16, 0x10, 0x06, 0x21, 0x10, 0x0d,
+    0x10, 0x21, 0x10, 0x0d, 0x21, 0x16, 0x07, 0x17, 0x07, 0x06, 0x16, 0x0e,
+    0x06, 0x22, 0x16, 0x16, 0x10, 0x16, 0x07, 0x10, 0x10, 0x10, 0x06, 0x06,
+    0x10, 0x07, 0x0d, 0x06, 0x04, 0x16, 0x17, 0x07, 0x0d, 0x0e, 0x0d, 0x17,
+    0x06, 0x0d, 0x22, 0x0d, 0x16, 0x06, 0x16, 0x22, 0x10, 0x06, 0x07, 0x0d,
+    0x16, 0x21, 0x10, 0x16, 0x0d, 0x16, 0x0d, 0x0e, 0x16, 0x07, 0x0d, 0x07,
+    0x1f, 0x16, 0x16, 0x21, 0x16, 0x16, 0x10, 0x04, 0x0d, 0x16, 0x07, 0x0d,
+    0x0d, 0x0d, 0x06, 0x06, 0x22, 0x16, 0x06, 0x06, 0x16, 0x10, 0x16, 0x0d,
+    0x07, 0x07, 0x06, 0x16, 0x06, 0x10, 0x06, 0x0d, 0x07, 0x16, 0x10, 0x12,
+    0x07, 0x07, 0x0e, 0x0e, 0x16, 0x06, 0x07, 0x10, 0x16, 0x07, 0x06, 0x06,
+    0x0d, 0x10, 0x06, 0x06, 0x07, 0x0d, 0x22, 0x22, 0x10, 0x0d, 0x07, 0x07,
+    0x0e, 0x07, 0x16, 0x0d, 0x0d, 0x06, 0x06, 0x0d, 0x10, 0x10, 0x0d, 0x10,
+    0x0e, 0x0d, 0x0d, 0x06, 0x0d, 0x07, 0x17, 0x07, 0x1f, 0x10, 0x10, 0x0d,
+    0x10, 0x06, 0x16, 0x10, 0x16, 0x06, 0x0d, 0x16, 0x07, 0x0d, 0x06, 0x05,
+    0x0d, 0x0d, 0x07, 0x22, 0x07, 0x0a, 0x06, 0x06, 0x06, 0x22, 0x07, 0x16,
+    0x07, 0x10, 0x17, 0x06, 0x1f, 0x0d, 0x16, 0x10, 0x06, 0x07, 0x0d, 0x06,
+    0x07, 0x16, 0x10, 0x0d, 0x16, 0x0d, 0x17, 0x16, 0x04, 0x1f, 0x0d, 0x1f,
+    0x16, 0x16, 0x04, 0x16, 0x06, 0x07, 0x17, 0x0d, 0x16, 0x0d, 0x07, 0x0d,
+    0x0d, 0x0d, 0x1f, 0x22, 0x07, 0x06, 0x06, 0x16, 0x05, 0x09, 0x0c, 0x0a,
+    0x0b, 0x0d, 0x02, 0x05, 0x06, 0x06, 0x06, 0x06, 0x09, 0x0b, 0x0a, 0x08,
+    0x06, 0x16, 0x22, 0x16, 0x06, 0x07, 0x1f, 0x04, 0x21, 0x10, 0x16, 0x0d,
+    0x10, 0x06, 0x16, 0x10, 0x07, 0x0d, 0x07, 0x22, 0x1a, 0x07, 0x0d, 0x10,
+    0x06, 0x10, 0x21, 0x0d, 0x06, 0x06, 0x0d, 0x10, 0x0d, 0x06, 0x06, 0x0e,
+    0x0d, 0x0d, 0x1f, 0x0f, 0x10, 0x16, 0x0d, 0x24, 0x10, 0x10, 0x0d, 0x06,
+    0x06, 0x08, 0x06, 0x02, 0x06, 0x0b, 0x0d, 0x04, 0x07, 0x09, 0x05, 0x0d,
+    0x0b, 0x08, 0x05, 0x02, 0x03, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x09, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x0d, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x0f, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x12, 0x0d, 0x0b, 0x02,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
+    0x04, 0x05, 0x08, 0x0c, 0x01, 0x01, 0x04, 0x01, 0x06, 0x0d, 0x06, 0x07,
+    0x01, 0x01, 0x01, 0x02, 0x05, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x06, 0x04, 0x09, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x08, 0x01, 0x05, 0x01,
+    0x01, 0x03, 0x05, 0x0e, 0x05, 0x01, 0x05, 0x01, 0x03, 0x05, 0x1a, 0x0b,
+    0x0c, 0x01, 0x02, 0x03, 0x01, 0x08, 0x05, 0x05, 0x09, 0x01, 0x02, 0x0c,
+    0x06, 0x05, 0x05, 0x05, 0x05, 0x01, 0x01, 0x0c, 0x07, 0x09, 0x09, 0x0b,
+    0x04, 0x02, 0x01, 0x02, 0x0c, 0x06, 0x01, 0x0a, 0x09, 0x02, 0x09, 0x08,
+    0x05, 0x0a, 0x03, 0x06, 0x09, 0x02, 0x09, 0x10, 0x05, 0x0a, 0x03, 0x09,
+    0x0b, 0x02, 0x0c, 0x0c, 0x09, 0x0b, 0x09, 0x01, 0x05, 0x03, 0x0c, 0x03,
+    0x05, 0x06, 0x10, 0x01, 0x05, 0x02, 0x02, 0x01, 0x05, 0x08, 0x08, 0x01,
+    0x09, 0x0c, 0x02, 0x02, 0x09, 0x08, 0x06, 0x01, 0x03, 0x02, 0x09, 0x02,
+    0x09, 0x08, 0x07, 0x01, 0x09, 0x03, 0x02, 0x09, 0x01, 0x02, 0x05, 0x03,
+    0x05, 0x03, 0x0c, 0x01, 0x0c, 0x05, 0x09, 0x02, 0x05, 0x02, 0x02, 0x02,
+    0x0a, 0x06, 0x02, 0x02, 0x09, 0x02, 0x04, 0x0c, 0x06, 0x07, 0x01, 0x09,
+    0x02, 0x05, 0x0b, 0x02, 0x0d, 0x05, 0x02, 0x09, 0x03, 0x05, 0x06, 0x0c,
+    0x0a, 0x08, 0x03, 0x02, 0x02, 0x09, 0x0b, 0x0c, 0x0b, 0x05, 0x05, 0x01,
+    0x0b, 0x05, 0x06, 0x01, 0x06, 0x03, 0x08, 0x01, 0x09, 0x09, 0x08, 0x02,
+    0x21, 0x21, 0x06, 0x16, 0x10, 0x20, 0x04, 0x21, 0x06, 0x10, 0x22, 0x10,
+    0x06, 0x04, 0x10, 0x10, 0x06, 0x10, 0x10, 0x10, 0x20, 0x06, 0x10, 0x06,
+    0x10, 0x22, 0x20, 0x04, 0x10, 0x10, 0x22, 0x10, 0x10, 0x1f, 0x06, 0x06,
+    0x10, 0x10, 0x10, 0x22, 0x04, 0x10, 0x10, 0x04, 0x20, 0x16, 0x10, 0x10,
+    0x10, 0x10, 0x07, 0x16, 0x06, 0x21, 0x22, 0x22, 0x10, 0x06, 0x20, 0x20,
+    0x10, 0x0d, 0x06, 0x10, 0x10, 0x20, 0x06, 0x16, 0x1a, 0x0d, 0x16, 0x20,
+    0x10, 0x16, 0x0d, 0x16, 0x1f, 0x17, 0x04, 0x0d, 0x22, 0x10, 0x0d, 0x16,
+    0x07, 0x10, 0x24, 0x07, 0x10, 0x0d, 0x07, 0x21, 0x21, 0x16, 0x0d, 0x10,
+    0x10, 0x10, 0x16, 0x0d, 0x07, 0x16, 0x10, 0x0d, 0x10, 0x06, 0x10, 0x16,
+    0x10, 0x10, 0x16, 0x0d, 0x10, 0x10, 0x16, 0x17, 0x0e, 0x17, 0x06, 0x10,
+    0x10, 0x10, 0x16, 0x06, 0x20, 0x10, 0x0e, 0x17, 0x10, 0x10, 0x22, 0x10,
+    0x1f, 0x0d, 0x0e, 0x16, 0x06, 0x16, 0x07, 0x0d, 0x07, 0x1f, 0x16, 0x16,
+    0x07, 0x07, 0x10, 0x0d, 0x07, 0x16, 0x16, 0x04, 0x16, 0x16, 0x0e, 0x0d,
+    0x10, 0x04, 0x10, 0x0d, 0x06, 0x1f, 0x07, 0x16, 0x07, 0x0d, 0x07, 0x10,
+    0x16, 0x0d, 0x16, 0x10, 0x06, 0x06, 0x10, 0x10, 0x10, 0x10, 0x0d, 0x16,
+    0x07, 0x0e, 0x17, 0x0d, 0x0d, 0x0d, 0x10, 0x06, 0x07, 0x04, 0x04, 0x07,
+    0x22, 0x10, 0x10, 0x10, 0x10, 0x0b, 0x06, 0x05, 0x10, 0x06, 0x16, 0x07,
+    0x06, 0x0e, 0x07, 0x04, 0x0d, 0x16, 0x07, 0x06, 0x04, 0x17, 0x0b, 0x03,
+    0x16, 0x16, 0x16, 0x07, 0x0d, 0x14, 0x0d, 0x03, 0x1f, 0x07, 0x1f, 0x0d,
+    0x10, 0x0d, 0x09, 0x01, 0x0e, 0x07, 0x07, 0x16, 0x17, 0x0f, 0x05, 0x01,
+    0x10, 0x10, 0x22, 0x07, 0x17, 0x19, 0x06, 0x01, 0x0e, 0x0d, 0x0d, 0x16,
+    0x05, 0x0d, 0x0d, 0x01, 0x02, 0x0c, 0x05, 0x02, 0x03, 0x03, 0x09, 0x04,
+    0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x03, 0x0b,
+    0x01, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x0b, 0x08, 0x25, 0x05, 0x01, 0x0d, 0x01, 0x01, 0x02, 0x09,
+    0x06, 0x01, 0x02, 0x05, 0x01, 0x01, 0x05, 0x07, 0x08, 0x03, 0x09, 0x05,
+    0x01, 0x02, 0x05, 0x08, 0x05, 0x05, 0x08, 0x02, 0x01, 0x02, 0x06, 0x02,
+    0x02, 0x06, 0x0d, 0x03, 0x01, 0x01, 0x05, 0x08, 0x01, 0x06, 0x06, 0x03,
+    0x01, 0x01, 0x02, 0x02, 0x01, 0x0a, 0x08, 0x03, 0x01, 0x01, 0x09, 0x06,
+    0x01, 0x06, 0x06, 0x02, 0x01, 0x06, 0x01, 0x05, 0x03, 0x03, 0x01, 0x03,
+    0x03, 0x05, 0x03, 0x09, 0x01, 0x02, 0x01, 0x03, 0x03, 0x05, 0x03, 0x02,
+    0x02, 0x02, 0x01, 0x01, 0x0c, 0x05, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
+    0x02, 0x0c, 0x09, 0x09, 0x09, 0x02, 0x01, 0x01, 0x09, 0x02, 0x05, 0x06,
+    0x09, 0x0c, 0x01, 0x03, 0x02, 0x02, 0x05, 0x0b, 0x05, 0x05, 0x01, 0x03,
+    0x01, 0x0c, 0x09, 0x0b, 0x02, 0x0b, 0x03, 0x03, 0x02, 0x08, 0x09, 0x03,
+    0x0b, 0x01, 0x01, 0x05, 0x08, 0x0b, 0x02, 0x03, 0x0c, 0x02, 0x01, 0x09,
+    0x06, 0x05, 0x02, 0x02, 0x09, 0x05, 0x01, 0x09, 0x06, 0x06, 0x0c, 0x09,
+    0x04, 0x05, 0x01, 0x05, 0x09, 0x05, 0x06, 0x09, 0x03, 0x05, 0x01, 0x09,
+    0x02, 0x05, 0x0a, 0x09, 0x04, 0x02, 0x03, 0x09, 0x03, 0x0b, 0x06, 0x09,
+    0x04, 0x02, 0x03, 0x09, 0x01, 0x05, 0x0d, 0x02, 0x04, 0x01, 0x03, 0x02,
+    0x07, 0x02, 0x0b, 0x01, 0x04, 0x02, 0x0d, 0x04, 0x16, 0x03, 0x06, 0x03,
+    0x03, 0x01, 0x07, 0x03, 0x16, 0x04, 0x07, 0x02, 0x02, 0x03, 0x16, 0x01,
+    0x10, 0x04, 0x05, 0x08, 0x02, 0x02, 0x16, 0x03, 0x05, 0x01, 0x09, 0x0a,
+    0x02, 0x05, 0x16, 0x02, 0x0b, 0x01, 0x0c, 0x0a, 0x01, 0x05, 0x05, 0x02,
+    0x06, 0x01, 0x02, 0x07, 0x03, 0x02, 0x05, 0x05, 0x0d, 0x01, 0x09, 0x0d,
+    0x03, 0x09, 0x05, 0x04, 0x0d, 0x10, 0x06, 0x10, 0x10, 0x10, 0x22, 0x22,
+    0x04, 0x06, 0x23, 0x10, 0x10, 0x04, 0x22, 0x10, 0x06, 0x10, 0x06, 0x06,
+    0x16, 0x22, 0x22, 0x10, 0x21, 0x06, 0x04, 0x22, 0x21, 0x06, 0x16, 0x1f,
+    0x04, 0x10, 0x10, 0x1f, 0x07, 0x10, 0x20, 0x10, 0x16, 0x10, 0x10, 0x16,
+    0x07, 0x10, 0x06, 0x06, 0x10, 0x22, 0x06, 0x07, 0x06, 0x22, 0x04, 0x21,
+    0x04, 0x1f, 0x10, 0x10, 0x06, 0x20, 0x10, 0x16, 0x22, 0x07, 0x16, 0x06,
+    0x16, 0x0e, 0x0d, 0x06, 0x10, 0x10, 0x0e, 0x16, 0x0e, 0x17, 0x0e, 0x16,
+    0x10, 0x10, 0x10, 0x0d, 0x16, 0x0d, 0x20, 0x1f, 0x10, 0x1f, 0x0d, 0x06,
+    0x06, 0x16, 0x22, 0x16, 0x06, 0x10, 0x0d, 0x10, 0x22, 0x10, 0x07, 0x07,
+    0x04, 0x0e, 0x07, 0x16, 0x07, 0x07, 0x16, 0x10, 0x21, 0x22, 0x10, 0x0d,
+    0x10, 0x22, 0x10, 0x0d, 0x0d, 0x0d, 0x07, 0x17, 0x07, 0x06, 0x07, 0x0e,
+    0x07, 0x16, 0x07, 0x0d, 0x06, 0x06, 0x0d, 0x0e, 0x22, 0x22, 0x20, 0x0e,
+    0x16, 0x0d, 0x0e, 0x0e, 0x07, 0x0d, 0x0d, 0x10, 0x07, 0x07, 0x0d, 0x10,
+    0x06, 0x0d, 0x10, 0x17, 0x16, 0x06, 0x16, 0x10, 0x10, 0x06, 0x07, 0x0d,
+    0x16, 0x21, 0x10, 0x16, 0x17, 0x16, 0x0d, 0x0e, 0x16, 0x16, 0x0d, 0x07,
+    0x1f, 0x06, 0x16, 0x21, 0x16, 0x16, 0x10, 0x04, 0x0d, 0x16, 0x07, 0x0d,
+    0x0d, 0x0d, 0x06, 0x06, 0x06, 0x06, 0x0d, 0x06, 0x0d, 0x15, 0x06, 0x03,
+    0x0d, 0x10, 0x22, 0x20, 0x10, 0x06, 0x09, 0x01, 0x04, 0x07, 0x07, 0x0e,
+    0x17, 0x15, 0x05, 0x01, 0x06, 0x06, 0x07, 0x1f, 0x16, 0x12, 0x07, 0x01,
+    0x0d, 0x10, 0x06, 0x16, 0x08, 0x0a, 0x0d, 0x01, 0x10, 0x0d, 0x07, 0x0d,
+    0x07, 0x0a, 0x08, 0x05, 0x0d, 0x06, 0x06, 0x0d, 0x10, 0x0e, 0x07, 0x0a,
+    0x0e, 0x0d, 0x0d, 0x16, 0x0a, 0x07, 0x15, 0x0d, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x05, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x02, 0x02, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x0b, 0x09, 0x09, 0x0b, 0x02, 0x02, 0x01, 0x01,
+    0x01, 0x02, 0x08, 0x09, 0x02, 0x0b, 0x03, 0x08, 0x01, 0x02, 0x06, 0x04,
+    0x04, 0x07, 0x03, 0x08, 0x01, 0x01, 0x09, 0x05, 0x04, 0x07, 0x03, 0x06,
+    0x01, 0x01, 0x0c, 0x09, 0x04, 0x07, 0x01, 0x0d, 0x01, 0x03, 0x09, 0x06,
+    0x04, 0x16, 0x01, 0x0a, 0x01, 0x03, 0x0b, 0x04, 0x09, 0x05, 0x01, 0x05,
+    0x01, 0x03, 0x06, 0x05, 0x04, 0x08, 0x01, 0x0c, 0x01, 0x01, 0x02, 0x09,
+    0x04, 0x06, 0x01, 0x02, 0x01, 0x05, 0x05, 0x05, 0x03, 0x0b, 0x03, 0x02,
+    0x01, 0x02, 0x04, 0x06, 0x04, 0x0b, 0x03, 0x02, 0x01, 0x02, 0x01, 0x0a,
+    0x04, 0x05, 0x02, 0x02, 0x03, 0x03, 0x03, 0x06, 0x04, 0x0c, 0x02, 0x05,
+    0x05, 0x02, 0x03, 0x06, 0x04, 0x02, 0x03, 0x05, 0x06, 0x09, 0x0c, 0x10,
+    0x04, 0x0c, 0x03, 0x05, 0x06, 0x02, 0x0b, 0x05, 0x09, 0x03, 0x02, 0x05,
+    0x0a, 0x02, 0x0c, 0x09, 0x05, 0x01, 0x02, 0x02, 0x01, 0x08, 0x07, 0x09,
+    0x09, 0x01, 0x03, 0x03, 0x01, 0x06, 0x07, 0x09, 0x02, 0x01, 0x03, 0x03,
+    0x01, 0x10, 0x07, 0x09, 0x02, 0x03, 0x01, 0x01, 0x01, 0x05, 0x16, 0x05,
+    0x02, 0x02, 0x01, 0x01, 0x03, 0x04, 0x07, 0x09, 0x01, 0x09, 0x01, 0x01,
+    0x03, 0x02, 0x06, 0x05, 0x01, 0x05, 0x01, 0x01, 0x05, 0x01, 0x0a, 0x08,
+    0x01, 0x05, 0x01, 0x01, 0x0a, 0x01, 0x06, 0x08, 0x01, 0x05, 0x01, 0x02,
+    0x06, 0x01, 0x06, 0x26, 0x01, 0x05, 0x09, 0x02, 0x09, 0x03, 0x05, 0x05,
+    0x01, 0x16, 0x09, 0x02, 0x03, 0x02, 0x06, 0x03, 0x01, 0x07, 0x05, 0x02,
+    0x03, 0x0c, 0x06, 0x01, 0x01, 0x0d, 0x05, 0x04, 0x0c, 0x02, 0x0a, 0x01,
+    0x01, 0x06, 0x05, 0x10, 0x10, 0x02, 0x0d, 0x02, 0x01, 0x08, 0x06, 0x22,
+    0x07, 0x01, 0x08, 0x02, 0x01, 0x09, 0x10, 0x0e, 0x16, 0x01, 0x05, 0x02,
+    0x01, 0x01, 0x10, 0x0d, 0x06, 0x10, 0x10, 0x10, 0x20, 0x10, 0x16, 0x0d,
+    0x10, 0x22, 0x06, 0x10, 0x22, 0x07, 0x06, 0x0d, 0x10, 0x16, 0x10, 0x22,
+    0x16, 0x0d, 0x0d, 0x0d, 0x22, 0x20, 0x22, 0x10, 0x22, 0x10, 0x22, 0x10,
+    0x22, 0x10, 0x06, 0x07, 0x0d, 0x22, 0x16, 0x16, 0x06, 0x07, 0x07, 0x16,
+    0x10, 0x0d, 0x07, 0x0d, 0x1a, 0x10, 0x04, 0x10, 0x07, 0x16, 0x10, 0x16,
+    0x16, 0x07, 0x0d, 0x0d, 0x06, 0x10, 0x07, 0x06, 0x06, 0x10, 0x16, 0x16,
+    0x10, 0x16, 0x07, 0x10, 0x16, 0x06, 0x06, 0x06, 0x10, 0x07, 0x0d, 0x06,
+    0x10, 0x0d, 0x0d, 0x07, 0x0d, 0x0e, 0x0d, 0x17, 0x10, 0x22, 0x06, 0x16,
+    0x0e, 0x0d, 0x16, 0x20, 0x07, 0x0d, 0x07, 0x16, 0x1f, 0x17, 0x04, 0x0d,
+    0x1f, 0x06, 0x0d, 0x16, 0x07, 0x22, 0x24, 0x07, 0x07, 0x0e, 0x07, 0x21,
+    0x04, 0x16, 0x0d, 0x10, 0x07, 0x06, 0x16, 0x0d, 0x07, 0x16, 0x10, 0x07,
+    0x22, 0x16, 0x16, 0x06, 0x16, 0x10, 0x16, 0x0d, 0x0d, 0x07, 0x06, 0x16,
+    0x06, 0x10, 0x06, 0x0d, 0x07, 0x16, 0x10, 0x12, 0x07, 0x07, 0x0e, 0x0e,
+    0x10, 0x10, 0x22, 0x10, 0x10, 0x0d, 0x0e, 0x16, 0x06, 0x16, 0x07, 0x0d,
+    0x07, 0x06, 0x16, 0x16, 0x07, 0x07, 0x10, 0x0d, 0x07, 0x07, 0x16, 0x04,
+    0x16, 0x16, 0x0e, 0x0d, 0x10, 0x04, 0x10, 0x0d, 0x06, 0x06, 0x07, 0x16,
+    0x07, 0x0d, 0x0d, 0x1f, 0x10, 0x10, 0x22, 0x0d, 0x06, 0x02, 0x18, 0x0e,
+    0x07, 0x16, 0x0d, 0x16, 0x06, 0x03, 0x12, 0x0d, 0x0d, 0x0d, 0x07, 0x10,
+    0x07, 0x02, 0x0e, 0x17, 0x22, 0x22, 0x10, 0x10, 0x22, 0x0c, 0x19, 0x0d,
+    0x10, 0x06, 0x16, 0x07, 0x07, 0x0c, 0x19, 0x08, 0x0d, 0x16, 0x0d, 0x1f,
+    0x10, 0x0c, 0x14, 0x02, 0x16, 0x1f, 0x16, 0x0d, 0x0d, 0x0c, 0x11, 0x01,
+    0x10, 0x07, 0x06, 0x0d, 0x05, 0x05, 0x0e, 0x02, 0x05, 0x27, 0x07, 0x0d,
+    0x08, 0x05, 0x01, 0x01, 0x05, 0x19, 0x0d, 0x0f, 0x0e, 0x05, 0x06, 0x14,
+    0x0c, 0x0e, 0x12, 0x0d, 0x0f, 0x07, 0x0e, 0x07, 0x01, 0x19, 0x14, 0x0a,
+    0x1b, 0x0d, 0x0d, 0x06, 0x03, 0x12, 0x19, 0x0a, 0x11, 0x07, 0x15, 0x07,
+    0x05, 0x07, 0x12, 0x07, 0x11, 0x07, 0x07, 0x1a, 0x07, 0x05, 0x07, 0x06,
+    0x12, 0x09, 0x05, 0x0d, 0x15, 0x05, 0x08, 0x0e, 0x07, 0x0b, 0x07, 0x07,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x0c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x05, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x06, 0x05, 0x02,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x05, 0x04, 0x0a, 0x01, 0x02,
+    0x01, 0x02, 0x05, 0x06, 0x01, 0x07, 0x01, 0x05, 0x01, 0x03, 0x0b, 0x02,
+    0x03, 0x08, 0x02, 0x05, 0x01, 0x01, 0x0b, 0x08, 0x01, 0x02, 0x03, 0x08,
+    0x01, 0x01, 0x02, 0x02, 0x01, 0x03, 0x02, 0x06, 0x01, 0x01, 0x05, 0x06,
+    0x01, 0x02, 0x02, 0x0a, 0x01, 0x02, 0x05, 0x08, 0x01, 0x09, 0x03, 0x0d,
+    0x01, 0x03, 0x06, 0x02, 0x01, 0x06, 0x01, 0x0a, 0x0d, 0x03, 0x02, 0x09,
+    0x10, 0x01, 0x0c, 0x02, 0x0a, 0x03, 0x05, 0x09, 0x02, 0x01, 0x13, 0x02,
+    0x06, 0x01, 0x08, 0x09, 0x09, 0x02, 0x04, 0x04, 0x0c, 0x01, 0x16, 0x05,
+    0x02, 0x21, 0x10, 0x1f, 0x03, 0x01, 0x16, 0x05, 0x03, 0x1f, 0x10, 0x21,
+    0x01, 0x01, 0x06, 0x05, 0x22, 0x20, 0x10, 0x06, 0x03, 0x01, 0x05, 0x06,
+    0x20, 0x04, 0x06, 0x16, 0x02, 0x01, 0x05, 0x07, 0x10, 0x07, 0x07, 0x22,
+    0x0a, 0x02, 0x0b, 0x05, 0x01, 0x08, 0x01, 0x09, 0x0e, 0x02, 0x09, 0x09,
+    0x01, 0x12, 0x02, 0x02, 0x05, 0x02, 0x05, 0x09, 0x05, 0x06, 0x08, 0x0c,
+    0x10, 0x16, 0x16, 0x16, 0x0d, 0x16, 0x0d, 0x0d, 0x04, 0x04, 0x0d, 0x10,
+    0x22, 0x20, 0x10, 0x0e, 0x0d, 0x07, 0x04, 0x16, 0x07, 0x0e, 0x16, 0x10,
+    0x07, 0x10, 0x10, 0x06, 0x07, 0x06, 0x16, 0x0d, 0x10, 0x07, 0x0d, 0x06,
+    0x06, 0x06, 0x07, 0x0d, 0x16, 0x01, 0x05, 0x02, 0x0d, 0x16, 0x0d, 0x16,
+    0x07, 0x02, 0x22, 0x16, 0x10, 0x10, 0x10, 0x0d, 0x22, 0x22, 0x22, 0x0e,
+    0x0d, 0x0d, 0x0d, 0x06, 0x06, 0x06, 0x0e, 0x0d, 0x06, 0x16, 0x16, 0x07,
+    0x16, 0x0e, 0x17, 0x0e, 0x16, 0x10, 0x10, 0x20, 0x0d, 0x07, 0x0d, 0x04,
+    0x10, 0x07, 0x0d, 0x0d, 0x06, 0x06, 0x07, 0x04, 0x16, 0x06, 0x0d, 0x10,
+    0x10, 0x10, 0x10, 0x07, 0x0d, 0x10, 0x06, 0x16, 0x10, 0x06, 0x06, 0x10,
+    0x21, 0x0e, 0x07, 0x07, 0x16, 0x07, 0x0e, 0x0d, 0x0d, 0x10, 0x10, 0x10,
+    0x06, 0x07, 0x22, 0x04, 0x16, 0x0e, 0x0d, 0x0d, 0x17, 0x06, 0x06, 0x0d,
+    0x12, 0x06, 0x06, 0x0d, 0x0e, 0x16, 0x0d, 0x0e, 0x0e, 0x0d, 0x10, 0x22,
+    0x10, 0x16, 0x07, 0x0d, 0x06, 0x04, 0x16, 0x07, 0x0d, 0x16, 0x06, 0x16,
+    0x10, 0x10, 0x06, 0x07, 0x0d, 0x16, 0x22, 0x10, 0x06, 0x0d, 0x1f, 0x06,
+    0x16, 0x16, 0x10, 0x16, 0x10, 0x22, 0x16, 0x0d, 0x16, 0x07, 0x16, 0x0e,
+    0x0e, 0x0d, 0x06, 0x10, 0x07, 0x10, 0x16, 0x06, 0x20, 0x10, 0x0e, 0x0d,
+    0x06, 0x0d, 0x16, 0x06, 0x06, 0x0e, 0x0d, 0x06, 0x20, 0x06, 0x0e, 0x16,
+    0x0e, 0x17, 0x0e, 0x16, 0x0e, 0x16, 0x10, 0x0d, 0x07, 0x0d, 0x04, 0x10,
+    0x06, 0x16, 0x0d, 0x06, 0x06, 0x16, 0x04, 0x07, 0x06, 0x07, 0x0d, 0x10,
+    0x10, 0x10, 0x07, 0x07, 0x16, 0x0d, 0x16, 0x10, 0x06, 0x06, 0x10, 0x10,
+    0x10, 0x10, 0x0d, 0x16, 0x0d, 0x0e, 0x0d, 0x07, 0x0d, 0x0d, 0x10, 0x06,
+    0x07, 0x21, 0x04, 0x07, 0x07, 0x16, 0x07, 0x0d, 0x06, 0x06, 0x0d, 0x0e,
+    0x10, 0x10, 0x20, 0x0e, 0x16, 0x0d, 0x0e, 0x0e, 0x07, 0x0d, 0x0d, 0x10,
+    0x16, 0x07, 0x0d, 0x10, 0x06, 0x07, 0x10, 0x17, 0x16, 0x06, 0x16, 0x10,
+    0x10, 0x06, 0x07, 0x0d, 0x16, 0x22, 0x10, 0x06, 0x0e, 0x07, 0x07, 0x16,
+    0x07, 0x05, 0x06, 0x02, 0x10, 0x10, 0x10, 0x07, 0x07, 0x0b, 0x05, 0x05,
+    0x0e, 0x0d, 0x0d, 0x16, 0x06, 0x05, 0x02, 0x07, 0x06, 0x06, 0x0d, 0x16,
+    0x0d, 0x0c, 0x03, 0x17, 0x0d, 0x10, 0x10, 0x20, 0x10, 0x02, 0x03, 0x12,
+    0x04, 0x07, 0x07, 0x0e, 0x10, 0x0c, 0x03, 0x12, 0x1f, 0x06, 0x07, 0x06,
+    0x10, 0x05, 0x09, 0x17, 0x1a, 0x10, 0x06, 0x06, 0x06, 0x06, 0x02, 0x0a,
+    0x15, 0x02, 0x08, 0x15, 0x09, 0x0d, 0x08, 0x15, 0x11, 0x03, 0x06, 0x15,
+    0x09, 0x0d, 0x0b, 0x0d, 0x1b, 0x02, 0x07, 0x14, 0x09, 0x0f, 0x04, 0x05,
+    0x15, 0x03, 0x07, 0x19, 0x02, 0x15, 0x09, 0x05, 0x15, 0x03, 0x0d, 0x0d,
+    0x0b, 0x19, 0x05, 0x02, 0x15, 0x03, 0x12, 0x05, 0x06, 0x19, 0x05, 0x05,
+    0x15, 0x03, 0x0f, 0x02, 0x06, 0x12, 0x05, 0x05, 0x15, 0x01, 0x07, 0x05,
+    0x06, 0x07, 0x05, 0x06, 0x0e, 0x05, 0x02, 0x05, 0x02, 0x02, 0x01, 0x01,
+    0x0f, 0x06, 0x07, 0x08, 0x0d, 0x05, 0x0c, 0x02, 0x14, 0x0b, 0x0a, 0x0e,
+    0x14, 0x07, 0x07, 0x02, 0x14, 0x06, 0x05, 0x14, 0x12, 0x0d, 0x0d, 0x06,
+    0x11, 0x0c, 0x02, 0x1b, 0x26, 0x12, 0x15, 0x08, 0x11, 0x02, 0x02, 0x1b,
+    0x0b, 0x14, 0x19, 0x0e, 0x19, 0x0c, 0x09, 0x1b, 0x05, 0x14, 0x0d, 0x19,
+    0x0d, 0x02, 0x09, 0x0f, 0x05, 0x0f, 0x07, 0x08, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x04, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x15, 0x06, 0x03, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x06, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x15, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0e, 0x0a, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x0e, 0x17, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x05, 0x08, 0x01, 0x07, 0x01, 0x05, 0x01, 0x01, 0x02, 0x02,
+    0x04, 0x07, 0x01, 0x05, 0x01, 0x01, 0x09, 0x06, 0x04, 0x0d, 0x01, 0x09,
+    0x01, 0x02, 0x08, 0x05, 0x02, 0x10, 0x20, 0x20, 0x01, 0x02, 0x06, 0x09,
+    0x10, 0x23, 0x22, 0x10, 0x01, 0x01, 0x09, 0x08, 0x07, 0x10, 0x1f, 0x07,
+    0x01, 0x01, 0x0c, 0x09, 0x22, 0x10, 0x06, 0x16, 0x01, 0x03, 0x09, 0x0a,
+    0x10, 0x10, 0x22, 0x16, 0x0c, 0x01, 0x01, 0x04, 0x06, 0x17, 0x06, 0x16,
+    0x02, 0x04, 0x04, 0x10, 0x1f, 0x04, 0x16, 0x16, 0x21, 0x07, 0x16, 0x10,
+    0x10, 0x0d, 0x0d, 0x0d, 0x06, 0x22, 0x04, 0x10, 0x10, 0x10, 0x16, 0x06,
+    0x06, 0x10, 0x10, 0x06, 0x22, 0x06, 0x06, 0x10, 0x06, 0x16, 0x06, 0x10,
+    0x21, 0x0e, 0x07, 0x07, 0x10, 0x20, 0x21, 0x22, 0x04, 0x10, 0x1f, 0x0d,
+    0x20, 0x10, 0x22, 0x10, 0x10, 0x07, 0x07, 0x06, 0x07, 0x07, 0x10, 0x07,
+    0x0d, 0x07, 0x0e, 0x0d, 0x10, 0x04, 0x07, 0x16, 0x10, 0x0d, 0x10, 0x22,
+    0x06, 0x06, 0x0e, 0x0e, 0x0e, 0x1f, 0x0d, 0x07, 0x16, 0x0d, 0x1f, 0x22,
+    0x04, 0x0d, 0x06, 0x06, 0x10, 0x0d, 0x0d, 0x16, 0x0d, 0x16, 0x06, 0x06,
+    0x0e, 0x0e, 0x0d, 0x17, 0x0d, 0x10, 0x0d, 0x17, 0x0e, 0x16, 0x10, 0x04,
+    0x22, 0x10, 0x22, 0x06, 0x06, 0x0d, 0x22, 0x16, 0x06, 0x07, 0x0d, 0x07,
+    0x06, 0x16, 0x07, 0x16, 0x10, 0x0e, 0x07, 0x0d, 0x0d, 0x10, 0x22, 0x10,
+    0x0d, 0x1f, 0x06, 0x07, 0x17, 0x07, 0x06, 0x16, 0x0e, 0x0e, 0x16, 0x16,
+    0x16, 0x1f, 0x16, 0x07, 0x10, 0x22, 0x06, 0x16, 0x06, 0x10, 0x16, 0x0d,
+    0x16, 0x07, 0x0d, 0x06, 0x07, 0x0d, 0x0e, 0x0d, 0x17, 0x0d, 0x07, 0x10,
+    0x16, 0x1a, 0x0d, 0x16, 0x20, 0x22, 0x10, 0x22, 0x16, 0x06, 0x17, 0x04,
+    0x16, 0x06, 0x07, 0x07, 0x0e, 0x06, 0x16, 0x07, 0x07, 0x10, 0x07, 0x0d,
+    0x22, 0x16, 0x16, 0x10, 0x04, 0x07, 0x06, 0x1f, 0x0d, 0x0d, 0x0d, 0x06,
+    0x1f, 0x0e, 0x1a, 0x1a, 0x1f, 0x16, 0x06, 0x16, 0x0d, 0x10, 0x22, 0x21,
+    0x06, 0x06, 0x10, 0x10, 0x0d, 0x07, 0x16, 0x0d, 0x12, 0x07, 0x07, 0x0e,
+    0x0e, 0x0d, 0x0d, 0x0d, 0x10, 0x10, 0x0d, 0x0e, 0x16, 0x10, 0x21, 0x22,
+    0x0d, 0x07, 0x06, 0x16, 0x07, 0x22, 0x16, 0x16, 0x07, 0x0e, 0x07, 0x06,
+    0x07, 0x07, 0x16, 0x10, 0x0d, 0x10, 0x10, 0x0d, 0x10, 0x22, 0x10, 0x0d,
+    0x1f, 0x0e, 0x07, 0x17, 0x16, 0x06, 0x07, 0x0e, 0x0d, 0x1f, 0x06, 0x16,
+    0x1f, 0x0d, 0x16, 0x22, 0x16, 0x06, 0x06, 0x06, 0x10, 0x16, 0x0d, 0x06,
+    0x10, 0x17, 0x0d, 0x07, 0x0d, 0x0e, 0x0d, 0x17, 0x10, 0x22, 0x06, 0x16,
+    0x0e, 0x0d, 0x16, 0x20, 0x07, 0x0d, 0x07, 0x16, 0x06, 0x17, 0x04, 0x0d,
+    0x17, 0x07, 0x0d, 0x17, 0x06, 0x16, 0x07, 0x07, 0x1f, 0x06, 0x16, 0x22,
+    0x16, 0x16, 0x10, 0x04, 0x0e, 0x16, 0x07, 0x0d, 0x0d, 0x0d, 0x06, 0x06,
+    0x21, 0x16, 0x16, 0x06, 0x16, 0x06, 0x16, 0x0d, 0x0d, 0x0d, 0x06, 0x06,
+    0x06, 0x10, 0x10, 0x0d, 0x0d, 0x07, 0x10, 0x12, 0x07, 0x07, 0x0e, 0x0e,
+    0x22, 0x10, 0x22, 0x10, 0x10, 0x0d, 0x0e, 0x16, 0x06, 0x07, 0x0d, 0x0d,
+    0x07, 0x06, 0x16, 0x16, 0x10, 0x0d, 0x07, 0x0d, 0x07, 0x08, 0x09, 0x0a,
+    0x0d, 0x06, 0x06, 0x0d, 0x10, 0x05, 0x05, 0x06, 0x0e, 0x0d, 0x0d, 0x1f,
+    0x0d, 0x02, 0x0b, 0x06, 0x10, 0x22, 0x22, 0x0d, 0x08, 0x09, 0x05, 0x0d,
+    0x07, 0x16, 0x0d, 0x16, 0x16, 0x05, 0x05, 0x0a, 0x0d, 0x0d, 0x0d, 0x10,
+    0x0e, 0x0b, 0x05, 0x0d, 0x22, 0x22, 0x22, 0x10, 0x22, 0x10, 0x0c, 0x12,
+    0x10, 0x16, 0x16, 0x07, 0x0d, 0x16, 0x22, 0x12, 0x14, 0x01, 0x0a, 0x08,
+    0x08, 0x07, 0x0c, 0x1a, 0x0d, 0x01, 0x0a, 0x06, 0x16, 0x0a, 0x05, 0x0d,
+    0x06, 0x01, 0x0d, 0x0d, 0x0a, 0x08, 0x06, 0x0d, 0x08, 0x01, 0x0d, 0x0d,
+    0x06, 0x08, 0x06, 0x0b, 0x06, 0x01, 0x06, 0x0d, 0x12, 0x08, 0x0a, 0x0c,
+    0x06, 0x03, 0x0b, 0x07, 0x0f, 0x0b, 0x05, 0x02, 0x0d, 0x03, 0x03, 0x07,
+    0x14, 0x0c, 0x0c, 0x0c, 0x0d, 0x0c, 0x01, 0x06, 0x1e, 0x03, 0x05, 0x05,
+    0x08, 0x07, 0x06, 0x05, 0x0d, 0x07, 0x08, 0x06, 0x02, 0x12, 0x0d, 0x03,
+    0x14, 0x06, 0x10, 0x0d, 0x01, 0x0f, 0x07, 0x01, 0x1b, 0x08, 0x08, 0x19,
+    0x01, 0x1b, 0x16, 0x02, 0x15, 0x08, 0x0e, 0x0a, 0x03, 0x1b, 0x08, 0x0b,
+    0x19, 0x05, 0x19, 0x0b, 0x09, 0x1b, 0x09, 0x07, 0x0d, 0x0b, 0x19, 0x06,
+    0x09, 0x1b, 0x09, 0x0e, 0x0b, 0x05, 0x15, 0x0c, 0x09, 0x1b, 0x09, 0x0e,
+    0x08, 0x02, 0x14, 0x0d, 0x14, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x0a, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14, 0x0c, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x0e, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x19, 0x0d, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x19, 0x02, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x17, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x0f, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x05, 0x09,
+    0x16, 0x10, 0x10, 0x22, 0x01, 0x03, 0x06, 0x05, 0x06, 0x20, 0x20, 0x22,
+    0x01, 0x01, 0x02, 0x05, 0x1f, 0x06, 0x10, 0x1f, 0x01, 0x01, 0x09, 0x05,
+    0x20, 0x10, 0x04, 0x20, 0x01, 0x03, 0x05, 0x06, 0x10, 0x16, 0x16, 0x16,
+    0x01, 0x03, 0x0b, 0x02, 0x10, 0x10, 0x20, 0x20, 0x01, 0x03, 0x0b, 0x08,
+    0x1f, 0x22, 0x22, 0x16, 0x01, 0x01, 0x02, 0x0c, 0x07, 0x10, 0x16, 0x16,
+    0x04, 0x06, 0x10, 0x06, 0x20, 0x16, 0x07, 0x07, 0x06, 0x22, 0x22, 0x10,
+    0x06, 0x0d, 0x06, 0x20, 0x22, 0x10, 0x10, 0x22, 0x1f, 0x16, 0x07, 0x0d,
+    0x10, 0x06, 0x10, 0x06, 0x10, 0x10, 0x06, 0x06, 0x10, 0x10, 0x10, 0x04,
+    0x1f, 0x16, 0x0d, 0x0e, 0x16, 0x16, 0x06, 0x06, 0x22, 0x10, 0x0d, 0x22,
+    0x16, 0x22, 0x10, 0x10, 0x10, 0x0d, 0x06, 0x06, 0x07, 0x10, 0x22, 0x21,
+    0x20, 0x0d, 0x16, 0x0d, 0x07, 0x20, 0x0d, 0x07, 0x0d, 0x06, 0x10, 0x0d,
+    0x22, 0x0d, 0x16, 0x10, 0x16, 0x07, 0x0e, 0x07, 0x0d, 0x06, 0x10, 0x07,
+    0x06, 0x07, 0x16, 0x16, 0x10, 0x21, 0x1a, 0x07, 0x16, 0x07, 0x16, 0x10,
+    0x0d, 0x0d, 0x1f, 0x10, 0x10, 0x16, 0x07, 0x16, 0x04, 0x16, 0x0e, 0x0d,
+    0x07, 0x07, 0x10, 0x16, 0x07, 0x12, 0x06, 0x06, 0x0d, 0x06, 0x0d, 0x16,
+    0x0e, 0x0d, 0x0d, 0x1f, 0x10, 0x20, 0x10, 0x0e, 0x07, 0x07, 0x10, 0x10,
+    0x0d, 0x07, 0x07, 0x10, 0x21, 0x04, 0x16, 0x0d, 0x10, 0x16, 0x16, 0x1a,
+    0x0d, 0x07, 0x16, 0x10, 0x16, 0x16, 0x06, 0x0d, 0x16, 0x10, 0x22, 0x06,
+    0x0d, 0x06, 0x0d, 0x16, 0x0e, 0x0e, 0x0d, 0x06, 0x10, 0x10, 0x10, 0x0d,
+    0x06, 0x04, 0x10, 0x0e, 0x0d, 0x07, 0x0d, 0x06, 0x06, 0x06, 0x0e, 0x0d,
+    0x06, 0x16, 0x16, 0x07, 0x16, 0x0e, 0x17, 0x0e, 0x16, 0x10, 0x10, 0x20,
+    0x0d, 0x07, 0x07, 0x16, 0x20, 0x0d, 0x07, 0x0d, 0x0d, 0x10, 0x20, 0x10,
+    0x0d, 0x16, 0x10, 0x16, 0x16, 0x07, 0x0d, 0x0d, 0x06, 0x10, 0x07, 0x06,
+    0x10, 0x06, 0x06, 0x10, 0x21, 0x0e, 0x07, 0x07, 0x07, 0x0d, 0x0e, 0x0d,
+    0x0d, 0x10, 0x10, 0x10, 0x06, 0x07, 0x22, 0x04, 0x16, 0x17, 0x0d, 0x07,
+    0x0d, 0x06, 0x06, 0x0d, 0x12, 0x06, 0x06, 0x0d, 0x0e, 0x16, 0x0d, 0x0e,
+    0x0e, 0x0d, 0x1f, 0x10, 0x1f, 0x1f, 0x0d, 0x07, 0x07, 0x22, 0x1f, 0x07,
+    0x07, 0x0e, 0x07, 0x04, 0x04, 0x16, 0x0d, 0x10, 0x07, 0x16, 0x16, 0x0d,
+    0x07, 0x16, 0x10, 0x07, 0x16, 0x16, 0x10, 0x16, 0x10, 0x22, 0x16, 0x0d,
+    0x16, 0x07, 0x07, 0x0e, 0x1a, 0x0d, 0x06, 0x10, 0x07, 0x10, 0x16, 0x06,
+    0x20, 0x10, 0x0e, 0x0d, 0x06, 0x0d, 0x16, 0x06, 0x06, 0x0e, 0x0d, 0x06,
+    0x20, 0x16, 0x0e, 0x16, 0x0e, 0x17, 0x0e, 0x16, 0x07, 0x07, 0x10, 0x0d,
+    0x07, 0x07, 0x16, 0x20, 0x16, 0x16, 0x0e, 0x0d, 0x10, 0x20, 0x10, 0x0d,
+    0x16, 0x06, 0x07, 0x16, 0x07, 0x0d, 0x0d, 0x06, 0x06, 0x0d, 0x16, 0x10,
+    0x06, 0x06, 0x10, 0x22, 0x10, 0x10, 0x0d, 0x07, 0x0d, 0x0e, 0x0d, 0x07,
+    0x07, 0x0d, 0x1f, 0x06, 0x07, 0x21, 0x21, 0x07, 0x07, 0x16, 0x07, 0x0d,
+    0x06, 0x06, 0x0d, 0x0e, 0x10, 0x10, 0x20, 0x0e, 0x16, 0x0d, 0x0e, 0x0e,
+    0x0d, 0x07, 0x0d, 0x10, 0x06, 0x07, 0x10, 0x19, 0x16, 0x1f, 0x16, 0x07,
+    0x0e, 0x16, 0x10, 0x06, 0x10, 0x07, 0x06, 0x0d, 0x16, 0x16, 0x0d, 0x05,
+    0x0e, 0x16, 0x07, 0x16, 0x16, 0x10, 0x16, 0x06, 0x10, 0x10, 0x10, 0x07,
+    0x07, 0x07, 0x0e, 0x0d, 0x17, 0x0d, 0x07, 0x07, 0x10, 0x16, 0x06, 0x20,
+    0x06, 0x06, 0x0d, 0x06, 0x0d, 0x16, 0x06, 0x06, 0x0d, 0x10, 0x10, 0x20,
+    0x16, 0x0d, 0x16, 0x0e, 0x0d, 0x05, 0x01, 0x06, 0x0f, 0x03, 0x10, 0x08,
+    0x0d, 0x05, 0x03, 0x0d, 0x0e, 0x01, 0x08, 0x0a, 0x08, 0x06, 0x01, 0x0d,
+    0x07, 0x02, 0x05, 0x06, 0x10, 0x16, 0x03, 0x08, 0x10, 0x09, 0x05, 0x08,
+    0x0d, 0x10, 0x1f, 0x10, 0x02, 0x0d, 0x05, 0x0b, 0x10, 0x0e, 0x0e, 0x0d,
+    0x10, 0x06, 0x10, 0x06, 0x0e, 0x07, 0x06, 0x07, 0x16, 0x07, 0x07, 0x08,
+    0x0d, 0x0e, 0x16, 0x10, 0x10, 0x20, 0x0d, 0x09, 0x03, 0x1b, 0x09, 0x07,
+    0x05, 0x0c, 0x12, 0x10, 0x03, 0x1e, 0x09, 0x05, 0x06, 0x08, 0x06, 0x06,
+    0x03, 0x11, 0x09, 0x09, 0x06, 0x06, 0x05, 0x1a, 0x02, 0x0e, 0x02, 0x05,
+    0x06, 0x12, 0x0c, 0x12, 0x05, 0x0e, 0x03, 0x09, 0x17, 0x12, 0x01, 0x15,
+    0x02, 0x0f, 0x03, 0x09, 0x07, 0x19, 0x02, 0x0d, 0x02, 0x0f, 0x03, 0x09,
+    0x06, 0x15, 0x09, 0x0e, 0x05, 0x0f, 0x0c, 0x03, 0x05, 0x0f, 0x08, 0x08,
+    0x0e, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14, 0x0d, 0x03, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x0d, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x12, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x12, 0x06, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x0e, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x15, 0x06, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x09, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x06, 0x20, 0x06, 0x10, 0x16,
+    0x01, 0x02, 0x05, 0x06, 0x16, 0x10, 0x22, 0x06, 0x01, 0x03, 0x06, 0x02,
+    0x06, 0x21, 0x21, 0x21, 0x01, 0x01, 0x05, 0x06, 0x06, 0x10, 0x10, 0x10,
+    0x01, 0x01, 0x02, 0x02, 0x20, 0x06, 0x21, 0x04, 0x01, 0x01, 0x09, 0x0a,
+    0x10, 0x16, 0x10, 0x22, 0x01, 0x02, 0x0b, 0x05, 0x10, 0x10, 0x10, 0x06,
+    0x01, 0x02, 0x06, 0x04, 0x10, 0x22, 0x04, 0x10, 0x20, 0x21, 0x10, 0x06,
+    0x06, 0x10, 0x16, 0x07, 0x20, 0x10, 0x22, 0x06, 0x04, 0x0d, 0x16, 0x06,
+    0x10, 0x06, 0x04, 0x10, 0x10, 0x07, 0x07, 0x22, 0x10, 0x22, 0x16, 0x10,
+    0x06, 0x17, 0x06, 0x06, 0x21, 0x06, 0x22, 0x22, 0x06, 0x04, 0x16, 0x07,
+    0x10, 0x07, 0x16, 0x10, 0x10, 0x0d, 0x0d, 0x0d, 0x10, 0x22, 0x21, 0x10,
+    0x10, 0x10, 0x16, 0x16, 0x06, 0x10, 0x10, 0x06, 0x22, 0x1f, 0x06, 0x10,
+    0x07, 0x16, 0x04, 0x16, 0x16, 0x0d, 0x16, 0x10, 0x06, 0x1f, 0x10, 0x06,
+    0x16, 0x06, 0x16, 0x0d, 0x10, 0x10, 0x0d, 0x16, 0x06, 0x06, 0x07, 0x0d,
+    0x07, 0x07, 0x1f, 0x16, 0x0d, 0x07, 0x0e, 0x0d, 0x10, 0x04, 0x16, 0x16,
+    0x10, 0x0d, 0x10, 0x22, 0x06, 0x06, 0x0e, 0x0e, 0x0e, 0x24, 0x0d, 0x07,
+    0x16, 0x0d, 0x10, 0x22, 0x04, 0x0d, 0x06, 0x06, 0x10, 0x0d, 0x0d, 0x16,
+    0x0d, 0x16, 0x06, 0x06, 0x0d, 0x07, 0x0d, 0x04, 0x10, 0x07, 0x0d, 0x07,
+    0x06, 0x06, 0x07, 0x04, 0x16, 0x06, 0x07, 0x10, 0x10, 0x10, 0x10, 0x07,
+    0x0d, 0x10, 0x06, 0x16, 0x06, 0x16, 0x07, 0x16, 0x10, 0x17, 0x07, 0x0d,
+    0x0d, 0x10, 0x22, 0x10, 0x0d, 0x06, 0x06, 0x07, 0x0d, 0x07, 0x06, 0x16,
+    0x0e, 0x0d, 0x07, 0x16, 0x16, 0x06, 0x0d, 0x07, 0x10, 0x22, 0x06, 0x16,
+    0x06, 0x10, 0x16, 0x0d, 0x16, 0x0d, 0x0d, 0x06, 0x10, 0x16, 0x07, 0x0d,
+    0x06, 0x04, 0x16, 0x16, 0x17, 0x16, 0x06, 0x06, 0x10, 0x10, 0x06, 0x07,
+    0x0d, 0x16, 0x22, 0x10, 0x10, 0x1a, 0x06, 0x06, 0x0e, 0x06, 0x06, 0x07,
+    0x07, 0x10, 0x07, 0x0d, 0x22, 0x16, 0x16, 0x10, 0x04, 0x07, 0x06, 0x10,
+    0x0d, 0x0d, 0x0d, 0x06, 0x1f, 0x0e, 0x1a, 0x1a, 0x06, 0x16, 0x06, 0x16,
+    0x0d, 0x10, 0x22, 0x21, 0x06, 0x06, 0x10, 0x10, 0x0d, 0x0d, 0x16, 0x0d,
+    0x0d, 0x1f, 0x10, 0x0d, 0x07, 0x0d, 0x04, 0x10, 0x06, 0x16, 0x0d, 0x06,
+    0x06, 0x07, 0x04, 0x07, 0x06, 0x07, 0x0d, 0x10, 0x10, 0x10, 0x07, 0x07,
+    0x07, 0x0e, 0x07, 0x06, 0x16, 0x07, 0x16, 0x10, 0x0d, 0x10, 0x10, 0x0d,
+    0x10, 0x22, 0x10, 0x0d, 0x1f, 0x0e, 0x07, 0x0d, 0x16, 0x06, 0x07, 0x0e,
+    0x0d, 0x06, 0x06, 0x16, 0x06, 0x0d, 0x16, 0x22, 0x16, 0x06, 0x06, 0x06,
+    0x10, 0x16, 0x0d, 0x16, 0x07, 0x0d, 0x07, 0x10, 0x16, 0x07, 0x0d, 0x10,
+    0x06, 0x07, 0x10, 0x17, 0x16, 0x06, 0x16, 0x10, 0x1f, 0x06, 0x16, 0x0d,
+    0x16, 0x22, 0x10, 0x1f, 0x0d, 0x07, 0x0d, 0x17, 0x06, 0x06, 0x07, 0x07,
+    0x1f, 0x06, 0x07, 0x22, 0x16, 0x16, 0x10, 0x04, 0x0d, 0x16, 0x07, 0x0d,
+    0x0d, 0x0d, 0x06, 0x06, 0x22, 0x16, 0x16, 0x06, 0x16, 0x06, 0x16, 0x0d,
+    0x0d, 0x0d, 0x06, 0x06, 0x06, 0x10, 0x10, 0x0d, 0x04, 0x16, 0x16, 0x0d,
+    0x10, 0x10, 0x0d, 0x07, 0x1f, 0x06, 0x07, 0x06, 0x16, 0x07, 0x06, 0x06,
+    0x1a, 0x1f, 0x06, 0x06, 0x07, 0x0d, 0x10, 0x10, 0x10, 0x0d, 0x07, 0x07,
+    0x0e, 0x07, 0x06, 0x16, 0x07, 0x06, 0x1f, 0x0d, 0x22, 0x10, 0x0d, 0x10,
+    0x0e, 0x0d, 0x0d, 0x1f, 0x0e, 0x07, 0x0d, 0x16, 0x10, 0x22, 0x22, 0x0d,
+    0x1f, 0x06, 0x16, 0x06, 0x07, 0x16, 0x0d, 0x16, 0x06, 0x06, 0x1f, 0x10,
+    0x0d, 0x04, 0x10, 0x07, 0x0d, 0x16, 0x10, 0x10, 0x16, 0x04, 0x07, 0x06,
+    0x07, 0x10, 0x0e, 0x10, 0x10, 0x0d, 0x07, 0x06, 0x06, 0x16, 0x0d, 0x1f,
+    0x07, 0x16, 0x10, 0x0d, 0x07, 0x0d, 0x0d, 0x16, 0x22, 0x10, 0x0d, 0x10,
+    0x06, 0x16, 0x22, 0x07, 0x06, 0x07, 0x0e, 0x0d, 0x16, 0x07, 0x07, 0x0d,
+    0x0d, 0x16, 0x22, 0x21, 0x16, 0x16, 0x06, 0x16, 0x16, 0x0d, 0x16, 0x0d,
+    0x0d, 0x06, 0x06, 0x06, 0x05, 0x15, 0x0c, 0x03, 0x02, 0x15, 0x06, 0x06,
+    0x06, 0x15, 0x13, 0x02, 0x03, 0x14, 0x06, 0x10, 0x05, 0x15, 0x05, 0x05,
+    0x02, 0x15, 0x0c, 0x03, 0x10, 0x06, 0x08, 0x04, 0x0c, 0x15, 0x03, 0x0b,
+    0x16, 0x05, 0x08, 0x08, 0x02, 0x19, 0x01, 0x08, 0x0d, 0x06, 0x10, 0x04,
+    0x04, 0x06, 0x03, 0x12, 0x06, 0x16, 0x0d, 0x17, 0x0d, 0x10, 0x04, 0x12,
+    0x10, 0x10, 0x0d, 0x16, 0x16, 0x0d, 0x06, 0x08, 0x15, 0x05, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x12, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x12, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x15, 0x09, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x0a, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x14, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0e, 0x07, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x19, 0x0d, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x09, 0x08, 0x07, 0x10, 0x10, 0x07, 0x01, 0x01, 0x0c, 0x09,
+    0x22, 0x22, 0x06, 0x16, 0x01, 0x03, 0x09, 0x0a, 0x10, 0x10, 0x22, 0x16,
+    0x01, 0x03, 0x05, 0x09, 0x16, 0x10, 0x1f, 0x22, 0x01, 0x02, 0x06, 0x05,
+    0x06, 0x20, 0x20, 0x22, 0x01, 0x01, 0x02, 0x05, 0x1f, 0x06, 0x1f, 0x06,
+    0x01, 0x01, 0x09, 0x05, 0x20, 0x10, 0x04, 0x20, 0x01, 0x03, 0x09, 0x06,
+    0x10, 0x16, 0x16, 0x16, 0x06, 0x16, 0x06, 0x10, 0x21, 0x0e, 0x07, 0x16,
+    0x10, 0x20, 0x21, 0x22, 0x20, 0x10, 0x1f, 0x0d, 0x20, 0x10, 0x10, 0x10,
+    0x10, 0x16, 0x07, 0x06, 0x04, 0x1f, 0x10, 0x06, 0x20, 0x16, 0x07, 0x07,
+    0x06, 0x22, 0x22, 0x10, 0x06, 0x0d, 0x06, 0x20, 0x22, 0x10, 0x10, 0x22,
+    0x1f, 0x16, 0x07, 0x0d, 0x10, 0x06, 0x22, 0x06, 0x10, 0x10, 0x06, 0x06,
+    0x10, 0x10, 0x10, 0x04, 0x1f, 0x16, 0x0d, 0x0e, 0x0e, 0x0e, 0x07, 0x17,
+    0x0d, 0x10, 0x0d, 0x17, 0x0e, 0x16, 0x10, 0x04, 0x22, 0x10, 0x22, 0x16,
+    0x06, 0x0d, 0x22, 0x16, 0x16, 0x07, 0x0d, 0x16, 0x07, 0x20, 0x0d, 0x07,
+    0x0d, 0x06, 0x10, 0x0d, 0x22, 0x0d, 0x16, 0x10, 0x16, 0x07, 0x0e, 0x07,
+    0x0d, 0x06, 0x10, 0x07, 0x06, 0x07, 0x16, 0x16, 0x10, 0x21, 0x1a, 0x07,
+    0x16, 0x0d, 0x16, 0x22, 0x0d, 0x0d, 0x06, 0x10, 0x10, 0x16, 0x07, 0x07,
+    0x07, 0x0d, 0x0e, 0x0d, 0x17, 0x0d, 0x07, 0x10, 0x16, 0x1a, 0x0d, 0x16,
+    0x04, 0x22, 0x22, 0x22, 0x07, 0x06, 0x17, 0x04, 0x16, 0x06, 0x07, 0x0d,
+    0x07, 0x0d, 0x10, 0x10, 0x07, 0x07, 0x07, 0x10, 0x04, 0x04, 0x16, 0x0d,
+    0x10, 0x16, 0x16, 0x1a, 0x0d, 0x07, 0x16, 0x10, 0x16, 0x16, 0x06, 0x0d,
+    0x16, 0x10, 0x21, 0x06, 0x0d, 0x06, 0x0d, 0x16, 0x0e, 0x0e, 0x0d, 0x06,
+    0x1f, 0x1f, 0x10, 0x0d, 0x12, 0x07, 0x16, 0x0e, 0x0e, 0x0d, 0x0d, 0x0d,
+    0x10, 0x10, 0x0d, 0x0e, 0x16, 0x10, 0x21, 0x22, 0x07, 0x07, 0x06, 0x16,
+    0x07, 0x22, 0x16, 0x16, 0x0d, 0x07, 0x07, 0x16, 0x20, 0x0d, 0x07, 0x0d,
+    0x0d, 0x10, 0x20, 0x10, 0x0d, 0x16, 0x10, 0x16, 0x16, 0x07, 0x0d, 0x0d,
+    0x06, 0x10, 0x07, 0x06, 0x10, 0x06, 0x06, 0x10, 0x21, 0x0e, 0x07, 0x16,
+    0x07, 0x0d, 0x0e, 0x0d, 0x07, 0x1f, 0x10, 0x10, 0x10, 0x0e, 0x0d, 0x07,
+    0x0d, 0x0e, 0x0d, 0x17, 0x10, 0x22, 0x16, 0x16, 0x0e, 0x0d, 0x16, 0x20,
+    0x07, 0x0d, 0x16, 0x16, 0x06, 0x17, 0x04, 0x07, 0x1f, 0x1f, 0x0d, 0x07,
+    0x0d, 0x22, 0x10, 0x07, 0x07, 0x0e, 0x07, 0x04, 0x04, 0x16, 0x0d, 0x10,
+    0x07, 0x16, 0x16, 0x0d, 0x0d, 0x16, 0x10, 0x07, 0x07, 0x16, 0x10, 0x16,
+    0x10, 0x21, 0x16, 0x0d, 0x16, 0x07, 0x07, 0x0e, 0x1a, 0x0d, 0x06, 0x10,
+    0x0d, 0x07, 0x10, 0x12, 0x07, 0x16, 0x0e, 0x0e, 0x22, 0x10, 0x21, 0x1f,
+    0x10, 0x0d, 0x0e, 0x16, 0x06, 0x07, 0x0d, 0x07, 0x07, 0x06, 0x16, 0x16,
+    0x07, 0x07, 0x22, 0x0d, 0x07, 0x07, 0x16, 0x20, 0x16, 0x16, 0x0e, 0x0d,
+    0x10, 0x20, 0x10, 0x0d, 0x16, 0x06, 0x07, 0x16, 0x07, 0x0d, 0x0d, 0x06,
+    0x06, 0x0d, 0x16, 0x10, 0x06, 0x06, 0x10, 0x22, 0x1f, 0x10, 0x0d, 0x07,
+    0x0d, 0x0e, 0x0d, 0x07, 0x0d, 0x0d, 0x0d, 0x10, 0x0e, 0x0d, 0x07, 0x0d,
+    0x10, 0x21, 0x22, 0x22, 0x22, 0x06, 0x16, 0x0e, 0x10, 0x16, 0x16, 0x07,
+    0x0d, 0x16, 0x16, 0x06, 0x0d, 0x07, 0x0d, 0x10, 0x06, 0x0d, 0x07, 0x0d,
+    0x16, 0x10, 0x16, 0x07, 0x0e, 0x16, 0x04, 0x04, 0x10, 0x07, 0x06, 0x07,
+    0x16, 0x07, 0x0d, 0x0d, 0x0e, 0x16, 0x07, 0x16, 0x16, 0x10, 0x16, 0x10,
+    0x1f, 0x10, 0x10, 0x16, 0x07, 0x07, 0x0e, 0x0d, 0x0e, 0x0d, 0x0e, 0x0d,
+    0x16, 0x06, 0x12, 0x07, 0x0d, 0x16, 0x20, 0x22, 0x10, 0x04, 0x06, 0x1f,
+    0x17, 0x20, 0x0d, 0x06, 0x07, 0x0d, 0x07, 0x07, 0x22, 0x24, 0x07, 0x07,
+    0x07, 0x22, 0x0d, 0x07, 0x07, 0x0d, 0x10, 0x16, 0x16, 0x0e, 0x0d, 0x10,
+    0x16, 0x10, 0x07, 0x16, 0x06, 0x07, 0x16, 0x0d, 0x21, 0x16, 0x0d, 0x06,
+    0x0d, 0x16, 0x10, 0x06, 0x0d, 0x06, 0x10, 0x1f, 0x10, 0x0d, 0x07, 0x0d,
+    0x16, 0x0e, 0x17, 0x0d, 0x0d, 0x0d, 0x10, 0x1a, 0x0d, 0x0e, 0x16, 0x22,
+    0x22, 0x22, 0x22, 0x10, 0x06, 0x07, 0x06, 0x10, 0x06, 0x16, 0x07, 0x19,
+    0x07, 0x06, 0x04, 0x0d, 0x07, 0x0d, 0x10, 0x10, 0x20, 0x10, 0x0d, 0x06,
+    0x10, 0x16, 0x0d, 0x07, 0x07, 0x0d, 0x06, 0x10, 0x07, 0x06, 0x0d, 0x06,
+    0x06, 0x10, 0x10, 0x0e, 0x16, 0x07, 0x16, 0x0d, 0x0e, 0x0d, 0x07, 0x16,
+    0x10, 0x10, 0x16, 0x12, 0x19, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x0d, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x19, 0x05, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x0e, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x14, 0x0d, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0d, 0x02, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x12, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x19, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x0b, 0x02,
+    0x10, 0x10, 0x20, 0x04, 0x01, 0x03, 0x0b, 0x08, 0x10, 0x22, 0x22, 0x16,
+    0x01, 0x01, 0x02, 0x0c, 0x07, 0x10, 0x16, 0x16, 0x01, 0x01, 0x05, 0x06,
+    0x20, 0x06, 0x10, 0x16, 0x01, 0x02, 0x05, 0x06, 0x16, 0x10, 0x22, 0x06,
+    0x01, 0x03, 0x08, 0x02, 0x06, 0x21, 0x21, 0x21, 0x01, 0x01, 0x05, 0x08,
+    0x06, 0x22, 0x10, 0x10, 0x01, 0x01, 0x02, 0x02, 0x04, 0x06, 0x21, 0x04,
+    0x06, 0x16, 0x06, 0x06, 0x22, 0x10, 0x0d, 0x22, 0x16, 0x22, 0x10, 0x10,
+    0x10, 0x0d, 0x06, 0x06, 0x16, 0x1f, 0x10, 0x22, 0x20, 0x0d, 0x16, 0x0d,
+    0x20, 0x04, 0x10, 0x06, 0x10, 0x10, 0x16, 0x07, 0x20, 0x10, 0x22, 0x1f,
+    0x04, 0x0d, 0x16, 0x06, 0x10, 0x06, 0x21, 0x10, 0x10, 0x16, 0x07, 0x10,
+    0x10, 0x22, 0x16, 0x10, 0x06, 0x0d, 0x06, 0x06, 0x21, 0x06, 0x22, 0x22,
+    0x06, 0x04, 0x16, 0x07, 0x04, 0x16, 0x17, 0x0d, 0x16, 0x07, 0x10, 0x16,
+    0x07, 0x12, 0x06, 0x06, 0x0d, 0x06, 0x0d, 0x16, 0x0e, 0x0d, 0x0d, 0x16,
+    0x10, 0x04, 0x10, 0x0e, 0x0d, 0x16, 0x04, 0x06, 0x16, 0x0d, 0x1f, 0x10,
+    0x06, 0x06, 0x10, 0x06, 0x16, 0x16, 0x16, 0x0d, 0x10, 0x10, 0x0d, 0x16,
+    0x16, 0x06, 0x07, 0x0d, 0x16, 0x07, 0x1f, 0x16, 0x0d, 0x07, 0x0e, 0x0d,
+    0x10, 0x04, 0x16, 0x16, 0x10, 0x07, 0x10, 0x22, 0x06, 0x04, 0x10, 0x0e,
+    0x0d, 0x07, 0x0d, 0x06, 0x06, 0x06, 0x0e, 0x0d, 0x06, 0x16, 0x16, 0x07,
+    0x16, 0x0e, 0x17, 0x0e, 0x16, 0x10, 0x10, 0x20, 0x0d, 0x07, 0x0d, 0x04,
+    0x10, 0x16, 0x07, 0x07, 0x06, 0x06, 0x0d, 0x04, 0x16, 0x06, 0x07, 0x10,
+    0x10, 0x10, 0x10, 0x07, 0x0d, 0x1f, 0x06, 0x16, 0x06, 0x06, 0x07, 0x16,
+    0x10, 0x0d, 0x07, 0x0d, 0x0d, 0x1f, 0x22, 0x10, 0x0d, 0x06, 0x06, 0x0d,
+    0x06, 0x07, 0x22, 0x04, 0x16, 0x17, 0x0d, 0x07, 0x0d, 0x1f, 0x06, 0x07,
+    0x12, 0x06, 0x06, 0x0d, 0x0e, 0x16, 0x0d, 0x0e, 0x1a, 0x0d, 0x24, 0x10,
+    0x10, 0x16, 0x07, 0x0d, 0x06, 0x04, 0x16, 0x16, 0x17, 0x16, 0x06, 0x06,
+    0x10, 0x10, 0x06, 0x16, 0x0d, 0x16, 0x10, 0x10, 0x10, 0x0e, 0x16, 0x16,
+    0x0e, 0x06, 0x06, 0x16, 0x07, 0x10, 0x07, 0x0d, 0x22, 0x16, 0x16, 0x10,
+    0x04, 0x07, 0x16, 0x10, 0x07, 0x10, 0x16, 0x06, 0x04, 0x10, 0x0e, 0x0d,
+    0x06, 0x0d, 0x16, 0x06, 0x06, 0x0e, 0x0d, 0x06, 0x20, 0x16, 0x0e, 0x16,
+    0x0e, 0x0d, 0x0e, 0x16, 0x0d, 0x10, 0x10, 0x0d, 0x07, 0x0d, 0x04, 0x10,
+    0x06, 0x16, 0x0d, 0x06, 0x06, 0x07, 0x04, 0x07, 0x06, 0x07, 0x0d, 0x10,
+    0x10, 0x10, 0x07, 0x07, 0x07, 0x0e, 0x07, 0x06, 0x16, 0x07, 0x16, 0x10,
+    0x0d, 0x10, 0x10, 0x0d, 0x10, 0x22, 0x10, 0x0d, 0x07, 0x0d, 0x1f, 0x06,
+    0x07, 0x22, 0x21, 0x07, 0x16, 0x16, 0x07, 0x0d, 0x06, 0x06, 0x0d, 0x0e,
+    0x10, 0x10, 0x20, 0x0e, 0x16, 0x0d, 0x0e, 0x0e, 0x16, 0x0d, 0x16, 0x10,
+    0x16, 0x07, 0x0d, 0x1f, 0x06, 0x07, 0x10, 0x17, 0x16, 0x06, 0x16, 0x10,
+    0x06, 0x06, 0x16, 0x0d, 0x16, 0x10, 0x10, 0x10, 0x0d, 0x07, 0x0d, 0x0d,
+    0x06, 0x06, 0x16, 0x07, 0x1f, 0x06, 0x07, 0x22, 0x16, 0x16, 0x10, 0x21,
+    0x17, 0x0d, 0x07, 0x07, 0x10, 0x16, 0x06, 0x20, 0x06, 0x06, 0x0d, 0x16,
+    0x0d, 0x06, 0x06, 0x06, 0x0d, 0x1f, 0x10, 0x20, 0x16, 0x0d, 0x16, 0x0e,
+    0x04, 0x16, 0x16, 0x0d, 0x10, 0x10, 0x0d, 0x07, 0x10, 0x06, 0x07, 0x06,
+    0x16, 0x07, 0x06, 0x06, 0x0e, 0x06, 0x16, 0x06, 0x07, 0x0d, 0x10, 0x10,
+    0x10, 0x0d, 0x07, 0x07, 0x0e, 0x07, 0x06, 0x16, 0x07, 0x06, 0x1f, 0x0d,
+    0x22, 0x10, 0x0d, 0x10, 0x10, 0x0e, 0x0d, 0x07, 0x0d, 0x10, 0x16, 0x0d,
+    0x0e, 0x07, 0x06, 0x07, 0x16, 0x07, 0x1a, 0x08, 0x0d, 0x0e, 0x16, 0x10,
+    0x10, 0x20, 0x06, 0x06, 0x0d, 0x04, 0x10, 0x16, 0x0d, 0x16, 0x06, 0x07,
+    0x07, 0x04, 0x07, 0x06, 0x07, 0x10, 0x08, 0x12, 0x10, 0x0d, 0x07, 0x06,
+    0x06, 0x07, 0x05, 0x19, 0x07, 0x16, 0x10, 0x0d, 0x07, 0x0d, 0x19, 0x0e,
+    0x22, 0x10, 0x0d, 0x10, 0x06, 0x16, 0x06, 0x0b, 0x21, 0x04, 0x06, 0x16,
+    0x07, 0x06, 0x0d, 0x10, 0x0b, 0x07, 0x05, 0x0c, 0x06, 0x06, 0x0a, 0x04,
+    0x0d, 0x05, 0x08, 0x0d, 0x0c, 0x05, 0x09, 0x03, 0x05, 0x02, 0x02, 0x09,
+    0x01, 0x02, 0x01, 0x01, 0x05, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01,
+    0x0c, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x07, 0x08, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0a, 0x10, 0x16, 0x10, 0x22,
+    0x01, 0x02, 0x08, 0x10, 0x10, 0x10, 0x10, 0x06, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x22, 0x04, 0x10, 0x01, 0x01, 0x01, 0x01, 0x0d, 0x06, 0x0b, 0x05,
+    0x01, 0x01, 0x01, 0x01, 0x0b, 0x02, 0x06, 0x08, 0x01, 0x01, 0x01, 0x01,
+    0x03, 0x01, 0x05, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x05,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x07, 0x16, 0x06,
+    0x10, 0x07, 0x0d, 0x0d, 0x10, 0x22, 0x21, 0x10, 0x10, 0x10, 0x16, 0x16,
+    0x16, 0x10, 0x1f, 0x06, 0x22, 0x1f, 0x06, 0x10, 0x16, 0x16, 0x06, 0x10,
+    0x22, 0x0e, 0x16, 0x16, 0x21, 0x20, 0x21, 0x22, 0x20, 0x10, 0x06, 0x0d,
+    0x06, 0x02, 0x05, 0x10, 0x06, 0x16, 0x07, 0x06, 0x07, 0x0d, 0x01, 0x16,
+    0x20, 0x16, 0x07, 0x07, 0x02, 0x0b, 0x0d, 0x02, 0x06, 0x0d, 0x06, 0x20,
+    0x06, 0x06, 0x0e, 0x0e, 0x1a, 0x16, 0x0d, 0x07, 0x16, 0x0d, 0x10, 0x22,
+    0x04, 0x0d, 0x06, 0x06, 0x10, 0x0d, 0x0d, 0x16, 0x0d, 0x16, 0x06, 0x06,
+    0x0e, 0x0e, 0x07, 0x0d, 0x0d, 0x10, 0x0d, 0x17, 0x0e, 0x16, 0x10, 0x04,
+    0x22, 0x22, 0x22, 0x16, 0x06, 0x0d, 0x22, 0x16, 0x16, 0x0d, 0x0d, 0x16,
+    0x07, 0x20, 0x0d, 0x07, 0x0d, 0x06, 0x10, 0x0d, 0x22, 0x0d, 0x16, 0x10,
+    0x16, 0x07, 0x0e, 0x07, 0x0d, 0x16, 0x06, 0x16, 0x0e, 0x0d, 0x07, 0x16,
+    0x16, 0x16, 0x0d, 0x16, 0x10, 0x22, 0x06, 0x07, 0x06, 0x10, 0x06, 0x0d,
+    0x16, 0x0d, 0x0d, 0x06, 0x16, 0x07, 0x0e, 0x0d, 0x0d, 0x0d, 0x07, 0x10,
+    0x16, 0x1a, 0x0d, 0x16, 0x04, 0x22, 0x22, 0x21, 0x07, 0x06, 0x17, 0x04,
+    0x16, 0x06, 0x07, 0x0d, 0x07, 0x0d, 0x10, 0x10, 0x07, 0x07, 0x0d, 0x22,
+    0x04, 0x04, 0x16, 0x0d, 0x10, 0x24, 0x06, 0x0d, 0x0d, 0x0d, 0x0d, 0x06,
+    0x1f, 0x0e, 0x0d, 0x0d, 0x06, 0x16, 0x16, 0x16, 0x0d, 0x10, 0x22, 0x21,
+    0x06, 0x06, 0x10, 0x10, 0x0d, 0x0d, 0x16, 0x0d, 0x12, 0x16, 0x16, 0x0e,
+    0x0e, 0x07, 0x0d, 0x0d, 0x1f, 0x10, 0x0d, 0x0e, 0x16, 0x10, 0x21, 0x22,
+    0x07, 0x07, 0x06, 0x16, 0x07, 0x22, 0x16, 0x16, 0x0d, 0x07, 0x07, 0x16,
+    0x20, 0x0d, 0x07, 0x0d, 0x0d, 0x10, 0x20, 0x10, 0x0d, 0x16, 0x10, 0x16,
+    0x1f, 0x17, 0x07, 0x0d, 0x16, 0x06, 0x07, 0x0e, 0x0d, 0x06, 0x06, 0x16,
+    0x16, 0x0d, 0x16, 0x22, 0x16, 0x06, 0x06, 0x06, 0x10, 0x16, 0x0d, 0x16,
+    0x10, 0x0e, 0x0d, 0x16, 0x0d, 0x0e, 0x0d, 0x0d, 0x22, 0x22, 0x16, 0x16,
+    0x0e, 0x0d, 0x16, 0x04, 0x0d, 0x0d, 0x16, 0x07, 0x06, 0x17, 0x04, 0x07,
+    0x10, 0x10, 0x0d, 0x07, 0x0d, 0x10, 0x10, 0x07, 0x07, 0x0e, 0x07, 0x04,
+    0x04, 0x16, 0x0d, 0x10, 0x0d, 0x07, 0x16, 0x0d, 0x0d, 0x0d, 0x06, 0x06,
+    0x22, 0x06, 0x16, 0x06, 0x16, 0x16, 0x16, 0x0d, 0x0d, 0x0d, 0x06, 0x06,
+    0x06, 0x10, 0x10, 0x0d, 0x0d, 0x16, 0x06, 0x12, 0x16, 0x16, 0x0e, 0x0e,
+    0x22, 0x10, 0x04, 0x06, 0x10, 0x0d, 0x0e, 0x16, 0x06, 0x07, 0x0d, 0x16,
+    0x07, 0x06, 0x16, 0x16, 0x07, 0x07, 0x22, 0x0d, 0x07, 0x0d, 0x16, 0x20,
+    0x16, 0x06, 0x0e, 0x0d, 0x10, 0x20, 0x10, 0x0d, 0x0e, 0x0d, 0x0d, 0x1f,
+    0x0e, 0x07, 0x0d, 0x16, 0x10, 0x22, 0x22, 0x0d, 0x06, 0x16, 0x16, 0x16,
+    0x0d, 0x07, 0x0d, 0x16, 0x06, 0x06, 0x1f, 0x10, 0x0d, 0x0d, 0x0d, 0x10,
+    0x0e, 0x0d, 0x16, 0x0d, 0x10, 0x22, 0x22, 0x22, 0x22, 0x16, 0x16, 0x0e,
+    0x22, 0x16, 0x16, 0x0d, 0x0d, 0x16, 0x16, 0x06, 0x0d, 0x07, 0x0d, 0x10,
+    0x06, 0x0d, 0x07, 0x0d, 0x16, 0x10, 0x16, 0x07, 0x0e, 0x16, 0x04, 0x04,
+    0x06, 0x07, 0x0e, 0x0d, 0x16, 0x16, 0x1e, 0x0d, 0x0d, 0x16, 0x22, 0x21,
+    0x16, 0x06, 0x17, 0x0e, 0x16, 0x0d, 0x16, 0x0d, 0x0d, 0x06, 0x08, 0x14,
+    0x0e, 0x07, 0x17, 0x0d, 0x16, 0x06, 0x12, 0x07, 0x0d, 0x16, 0x20, 0x22,
+    0x10, 0x04, 0x07, 0x06, 0x17, 0x20, 0x0d, 0x06, 0x07, 0x07, 0x15, 0x07,
+    0x22, 0x24, 0x07, 0x07, 0x07, 0x22, 0x07, 0x1a, 0x16, 0x0d, 0x10, 0x16,
+    0x16, 0x0e, 0x07, 0x15, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x08, 0x15, 0x03,
+    0x10, 0x16, 0x07, 0x0d, 0x01, 0x05, 0x06, 0x02, 0x1f, 0x10, 0x06, 0x06,
+    0x01, 0x01, 0x02, 0x06, 0x02, 0x16, 0x0d, 0x0e, 0x01, 0x01, 0x03, 0x02,
+    0x09, 0x09, 0x07, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x02, 0x0d,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x0a, 0x05, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x03, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01,
+    0x0d, 0x16, 0x10, 0x0d, 0x06, 0x07, 0x16, 0x07, 0x10, 0x04, 0x1a, 0x07,
+    0x06, 0x0d, 0x16, 0x22, 0x0d, 0x07, 0x16, 0x1f, 0x1f, 0x16, 0x07, 0x07,
+    0x04, 0x16, 0x07, 0x16, 0x16, 0x0d, 0x06, 0x16, 0x0b, 0x07, 0x05, 0x06,
+    0x05, 0x06, 0x0d, 0x16, 0x02, 0x0c, 0x08, 0x05, 0x0d, 0x16, 0x0d, 0x0e,
+    0x03, 0x01, 0x02, 0x02, 0x05, 0x07, 0x06, 0x10, 0x01, 0x01, 0x01, 0x03,
+    0x0b, 0x0f, 0x08, 0x0d, 0x0d, 0x0d, 0x07, 0x10, 0x16, 0x07, 0x06, 0x0d,
+    0x16, 0x10, 0x21, 0x06, 0x0d, 0x06, 0x0d, 0x16, 0x0e, 0x1a, 0x0d, 0x06,
+    0x1f, 0x16, 0x10, 0x0d, 0x06, 0x04, 0x10, 0x17, 0x0d, 0x16, 0x0d, 0x06,
+    0x06, 0x06, 0x0e, 0x0d, 0x1f, 0x16, 0x16, 0x07, 0x16, 0x0e, 0x17, 0x0e,
+    0x16, 0x10, 0x10, 0x20, 0x0d, 0x07, 0x0d, 0x22, 0x22, 0x16, 0x07, 0x16,
+    0x06, 0x06, 0x0d, 0x20, 0x16, 0x06, 0x07, 0x10, 0x07, 0x07, 0x0d, 0x0d,
+    0x16, 0x10, 0x0d, 0x06, 0x10, 0x06, 0x06, 0x10, 0x04, 0x0e, 0x16, 0x16,
+    0x07, 0x0d, 0x0e, 0x0d, 0x07, 0x16, 0x1f, 0x1f, 0x06, 0x07, 0x22, 0x21,
+    0x07, 0x17, 0x0d, 0x16, 0x0d, 0x1f, 0x06, 0x07, 0x12, 0x06, 0x06, 0x0d,
+    0x0e, 0x16, 0x0d, 0x0e, 0x0d, 0x0d, 0x16, 0x10, 0x10, 0x16, 0x07, 0x0d,
+    0x06, 0x04, 0x06, 0x16, 0x17, 0x16, 0x06, 0x06, 0x06, 0x10, 0x06, 0x16,
+    0x07, 0x16, 0x07, 0x0d, 0x0d, 0x16, 0x10, 0x07, 0x0d, 0x16, 0x10, 0x16,
+    0x10, 0x21, 0x16, 0x0d, 0x16, 0x07, 0x07, 0x0e, 0x0d, 0x0d, 0x06, 0x1f,
+    0x07, 0x10, 0x16, 0x06, 0x04, 0x10, 0x17, 0x0d, 0x06, 0x0d, 0x16, 0x06,
+    0x06, 0x0e, 0x0d, 0x10, 0x20, 0x16, 0x0e, 0x16, 0x0e, 0x0d, 0x0e, 0x16,
+    0x0d, 0x10, 0x10, 0x0d, 0x07, 0x0d, 0x22, 0x10, 0x06, 0x16, 0x0d, 0x06,
+    0x06, 0x0d, 0x20, 0x07, 0x16, 0x06, 0x0d, 0x07, 0x07, 0x0d, 0x0d, 0x06,
+    0x06, 0x0d, 0x16, 0x10, 0x06, 0x06, 0x10, 0x21, 0x16, 0x10, 0x0d, 0x07,
+    0x0d, 0x0e, 0x0d, 0x07, 0x16, 0x0d, 0x06, 0x06, 0x07, 0x22, 0x22, 0x07,
+    0x16, 0x16, 0x07, 0x0d, 0x1f, 0x06, 0x0d, 0x0e, 0x10, 0x10, 0x20, 0x0e,
+    0x16, 0x0d, 0x0e, 0x1a, 0x16, 0x07, 0x16, 0x10, 0x16, 0x07, 0x0d, 0x1f,
+    0x06, 0x07, 0x10, 0x17, 0x16, 0x06, 0x16, 0x10, 0x10, 0x0d, 0x06, 0x07,
+    0x16, 0x07, 0x0d, 0x0d, 0x0e, 0x16, 0x16, 0x16, 0x16, 0x10, 0x16, 0x10,
+    0x16, 0x1f, 0x10, 0x16, 0x07, 0x07, 0x0e, 0x0d, 0x17, 0x07, 0x16, 0x07,
+    0x06, 0x07, 0x16, 0x20, 0x06, 0x06, 0x0d, 0x16, 0x0d, 0x0d, 0x05, 0x06,
+    0x0d, 0x16, 0x10, 0x20, 0x06, 0x0b, 0x0e, 0x06, 0x04, 0x16, 0x16, 0x0d,
+    0x10, 0x0a, 0x08, 0x09, 0x10, 0x06, 0x07, 0x16, 0x05, 0x19, 0x0a, 0x02,
+    0x16, 0x10, 0x07, 0x16, 0x06, 0x07, 0x0d, 0x06, 0x21, 0x16, 0x0d, 0x06,
+    0x0d, 0x16, 0x0e, 0x07, 0x0d, 0x16, 0x1f, 0x16, 0x10, 0x07, 0x15, 0x0d,
+    0x10, 0x07, 0x16, 0x06, 0x07, 0x06, 0x08, 0x07, 0x06, 0x05, 0x02, 0x0d,
+    0x05, 0x0d, 0x01, 0x01, 0x05, 0x08, 0x0a, 0x05, 0x02, 0x05, 0x01, 0x01,
+    0x02, 0x02, 0x09, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x07, 0x05, 0x0d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x06, 0x0d,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x10, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x05, 0x0a, 0x07, 0x01, 0x01, 0x01, 0x01, 0x02, 0x08, 0x08, 0x16,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06,
+    0x10, 0x10, 0x10, 0x07, 0x0d, 0x06, 0x06, 0x16, 0x06, 0x06, 0x07, 0x07,
+    0x10, 0x0d, 0x07, 0x0d, 0x0d, 0x1f, 0x10, 0x10, 0x0d, 0x06, 0x06, 0x0d,
+    0x0d, 0x16, 0x06, 0x16, 0x0e, 0x0d, 0x0d, 0x16, 0x16, 0x16, 0x0d, 0x07,
+    0x10, 0x22, 0x06, 0x07, 0x06, 0x04, 0x16, 0x08, 0x05, 0x0a, 0x08, 0x0d,
+    0x06, 0x06, 0x05, 0x08, 0x06, 0x07, 0x05, 0x08, 0x03, 0x02, 0x02, 0x03,
+    0x08, 0x02, 0x02, 0x02, 0x0d, 0x16, 0x10, 0x10, 0x10, 0x0e, 0x16, 0x16,
+    0x0e, 0x06, 0x06, 0x16, 0x07, 0x10, 0x16, 0x0d, 0x22, 0x16, 0x07, 0x10,
+    0x04, 0x16, 0x16, 0x10, 0x0d, 0x07, 0x0d, 0x06, 0x1f, 0x0e, 0x0d, 0x0d,
+    0x06, 0x16, 0x16, 0x16, 0x0d, 0x10, 0x22, 0x22, 0x09, 0x05, 0x10, 0x05,
+    0x07, 0x09, 0x06, 0x06, 0x06, 0x08, 0x0d, 0x09, 0x0b, 0x0a, 0x08, 0x07,
+    0x0c, 0x05, 0x02, 0x03, 0x03, 0x0b, 0x02, 0x0c, 0x06, 0x16, 0x0d, 0x10,
+    0x10, 0x10, 0x07, 0x0d, 0x07, 0x0e, 0x07, 0x06, 0x06, 0x07, 0x07, 0x10,
+    0x0d, 0x10, 0x10, 0x0d, 0x1f, 0x22, 0x10, 0x0d, 0x16, 0x17, 0x16, 0x0d,
+    0x16, 0x06, 0x07, 0x0e, 0x0d, 0x06, 0x16, 0x16, 0x16, 0x0d, 0x16, 0x22,
+    0x07, 0x10, 0x10, 0x06, 0x22, 0x06, 0x1a, 0x16, 0x09, 0x06, 0x09, 0x07,
+    0x0d, 0x0e, 0x0d, 0x0d, 0x01, 0x02, 0x06, 0x08, 0x0e, 0x0d, 0x16, 0x04,
+    0x06, 0x06, 0x16, 0x0d, 0x16, 0x10, 0x10, 0x10, 0x0d, 0x07, 0x0d, 0x0d,
+    0x06, 0x06, 0x16, 0x07, 0x1f, 0x06, 0x07, 0x22, 0x07, 0x16, 0x10, 0x21,
+    0x0d, 0x07, 0x16, 0x07, 0x0d, 0x0d, 0x06, 0x06, 0x22, 0x06, 0x07, 0x06,
+    0x16, 0x16, 0x16, 0x0d, 0x0d, 0x0d, 0x10, 0x02, 0x05, 0x05, 0x10, 0x07,
+    0x0d, 0x07, 0x05, 0x0a, 0x08, 0x0d, 0x09, 0x0b, 0x22, 0x20, 0x0c, 0x05,
+    0x09, 0x0c, 0x01, 0x03, 0x0e, 0x06, 0x16, 0x06, 0x10, 0x0d, 0x07, 0x03,
+    0x10, 0x0d, 0x07, 0x07, 0x0d, 0x15, 0x0b, 0x01, 0x07, 0x06, 0x10, 0x0d,
+    0x10, 0x0a, 0x05, 0x01, 0x0e, 0x0d, 0x0d, 0x10, 0x19, 0x15, 0x05, 0x01,
+    0x10, 0x22, 0x22, 0x0d, 0x16, 0x12, 0x0d, 0x03, 0x09, 0x06, 0x06, 0x0d,
+    0x05, 0x04, 0x02, 0x01, 0x0a, 0x08, 0x06, 0x05, 0x09, 0x01, 0x01, 0x01,
+    0x08, 0x03, 0x0c, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01,
+    0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x04, 0x16, 0x0e, 0x04, 0x16,
+    0x01, 0x01, 0x05, 0x0c, 0x04, 0x04, 0x24, 0x0d, 0x01, 0x01, 0x02, 0x0a,
+    0x06, 0x07, 0x05, 0x02, 0x01, 0x01, 0x01, 0x08, 0x05, 0x05, 0x08, 0x0a,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x05, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x09, 0x05, 0x03,
+    0x02, 0x01, 0x01, 0x01, 0x05, 0x05, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x0a, 0x0b, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x09, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const unsigned short map2_palette [] = {
+    0x7c1f, 0x0000, 0x1080, 0x1000, 0x1084, 0x2524, 0x35a9, 0x49ad, 0x3529,
+    0x2484, 0x49a9, 0x3524, 0x2480, 0x4a4d, 0x5a52, 0x6ed6, 0x2529, 0x7f7b,
+    0x5ad2, 0x2520, 0x6f76, 0x6f7b, 0x35ad, 0x4a52, 0x6ed2, 0x5ad6, 0x5a4d,
+    0x7fff, 0x35b2, 0x3652, 0x7ffb, 0x25a9, 0x0084, 0x1124, 0x1129, 0x1089,
+    0x25ad, 0x4a49, 0x35a4, 0x7f76, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000,
+};
+
+/* The tile map entry of each tile of the original image, for metagen -r. */
+#ifdef TILEGEN_REMAP
+const unsigned short map2_remap [] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000b, 0x000c, 0x000d, 0x000e,
+    0x000f, 0x0010, 0x0011, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019,
+    0x001a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001b,
+    0x001c, 0x001d, 0x001e, 0x001f, 0x0020, 0x0021, 0x0022, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0023, 0x0024, 0x0025, 0x0026,
+    0x0027, 0x0028, 0x0029, 0x002a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x002b, 0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033,
+    0x0034, 0x0000, 0x0000, 0x0000, 0x0000, 0x0035, 0x0036, 0x0037, 0x0038,
+    0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+    0x0046, 0x0047, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0048,
+    0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0052, 0x0053, 0x0054, 0x0055,
+    0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x005d, 0x005e, 0x005f, 0x0060, 0x0061, 0x0062, 0x0063,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0000, 0x0000, 0x0000, 0x0000, 0x0068,
+    0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071,
+    0x0072, 0x0000, 0x0000, 0x0000, 0x0000, 0x0073, 0x0074, 0x0075, 0x0076,
+    0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x007e, 0x007f, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084,
+    0x0085, 0x0086, 0x0087, 0x0088, 0x0000, 0x0000, 0x0000, 0x0000, 0x0089,
+    0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f, 0x0090, 0x0091, 0x0092,
+    0x0093, 0x0000, 0x0000, 0x0000, 0x0000, 0x0094, 0x0095, 0x0096, 0x0097,
+    0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x009e, 0x009f, 0x00a0, 0x00a1, 0x00a2, 0x00a3,
+    0x00a4, 0x00a5, 0x00a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x00a7, 0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00ad,
+    0x00ae, 0x00af, 0x00b0, 0x00b1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00b2,
+};
+#endif
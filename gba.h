@@ -0,0 +1,154 @@
+/*
+ * gba.h
+ * the hardware definitions shared by all of the gba programs
+ *
+ * every register is a constant pointer and every helper is static inline,
+ * so a use like *bg0_control = x compiles down to a single store
+ */
+
+#ifndef GBA_H
+#define GBA_H
+
+/* the width and height of the screen */
+#define WIDTH 240
+#define HEIGHT 160
+
+/* the video modes, 0-2 are tile modes and 3-4 are bitmap modes */
+#define MODE0 0x00
+#define MODE1 0x01
+#define MODE2 0x02
+#define MODE3 0x03
+#define MODE4 0x04
+
+/* enable bits for the four tile layers */
+#define BG0_ENABLE 0x100
+#define BG1_ENABLE 0x200
+#define BG2_ENABLE 0x400
+#define BG3_ENABLE 0x800
+
+/* the bitmap modes draw on bg2 */
+#define BG2 BG2_ENABLE
+
+/* this bit indicates whether to display the front or the back buffer in mode 4 */
+#define SHOW_BACK 0x10
+
+/* flags for sprite handling in the display control register */
+#define SPRITE_MAP_2D 0x0
+#define SPRITE_MAP_1D 0x40
+#define SPRITE_ENABLE 0x1000
+
+/* palette is always 256 colors */
+#define PALETTE_SIZE 256
+
+/* the display control pointer points to the gba graphics register */
+static volatile unsigned long* const display_control = (volatile unsigned long*) 0x4000000;
+
+/* the display status register, which also turns on the display interrupts */
+static volatile unsigned short* const display_status = (volatile unsigned short*) 0x4000004;
+
+/* the scanline counter is a memory cell which is updated to indicate how
+ * much of the screen has been drawn */
+static volatile unsigned short* const scanline_counter = (volatile unsigned short*) 0x4000006;
+
+/* the control registers for the four tile layers */
+static volatile unsigned short* const bg0_control = (volatile unsigned short*) 0x4000008;
+static volatile unsigned short* const bg1_control = (volatile unsigned short*) 0x400000a;
+static volatile unsigned short* const bg2_control = (volatile unsigned short*) 0x400000c;
+static volatile unsigned short* const bg3_control = (volatile unsigned short*) 0x400000e;
+
+/* scrolling registers for backgrounds */
+static volatile short* const bg0_x_scroll = (volatile short*) 0x4000010;
+static volatile short* const bg0_y_scroll = (volatile short*) 0x4000012;
+static volatile short* const bg1_x_scroll = (volatile short*) 0x4000014;
+static volatile short* const bg1_y_scroll = (volatile short*) 0x4000016;
+static volatile short* const bg2_x_scroll = (volatile short*) 0x4000018;
+static volatile short* const bg2_y_scroll = (volatile short*) 0x400001a;
+static volatile short* const bg3_x_scroll = (volatile short*) 0x400001c;
+static volatile short* const bg3_y_scroll = (volatile short*) 0x400001e;
+
+/* the addresses of the background and sprite palettes */
+static volatile unsigned short* const bg_palette = (volatile unsigned short*) 0x5000000;
+static volatile unsigned short* const sprite_palette = (volatile unsigned short*) 0x5000200;
+
+/* the screen in the bitmap modes, 240x160 16-bit colors in mode 3 */
+static volatile unsigned short* const screen = (volatile unsigned short*) 0x6000000;
+
+/* the two pages of mode 4 - the front buffer is the start of the screen
+ * and the back buffer is a pointer to the second half */
+static volatile unsigned short* const front_buffer = (volatile unsigned short*) 0x6000000;
+static volatile unsigned short* const back_buffer = (volatile unsigned short*) 0x600A000;
+
+/* the address of the sprite image data */
+static volatile unsigned short* const sprite_image_memory = (volatile unsigned short*) 0x6010000;
+
+/* the address of the sprite attributes */
+static volatile unsigned short* const sprite_attribute_memory = (volatile unsigned short*) 0x7000000;
+
+/* flag for turning on DMA */
+#define DMA_ENABLE 0x80000000
+
+/* flags for the sizes to transfer, 16 or 32 bits */
+#define DMA_16 0x00000000
+#define DMA_32 0x04000000
+
+/* return a pointer to the source, destination and count/control registers
+ * of one of the 4 DMA channels (0-3) */
+static inline volatile unsigned int* dma_channel(int channel) {
+    /* each channel has 3 32-bit registers */
+    return (volatile unsigned int*) (0x40000B0 + channel * 12);
+}
+
+/* return a pointer to the count/reload register of one of the 4 timers (0-3),
+ * the control register is the halfword after it */
+static inline volatile unsigned short* timer_registers(int timer) {
+    /* each timer has 2 16-bit registers */
+    return (volatile unsigned short*) (0x4000100 + timer * 4);
+}
+
+/* the button register holds the bits which indicate whether each button has
+ * been pressed - this has got to be volatile as well */
+static volatile unsigned short* const buttons = (volatile unsigned short*) 0x04000130;
+
+/* the key control register picks which buttons raise the key interrupt */
+static volatile unsigned short* const key_control = (volatile unsigned short*) 0x04000132;
+
+/* the bit positions indicate each button - the first bit is for A, second for
+ * B, and so on, each constant below can be ANDED into the register to get the
+ * status of any one button */
+#define BUTTON_A (1 << 0)
+#define BUTTON_B (1 << 1)
+#define BUTTON_SELECT (1 << 2)
+#define BUTTON_START (1 << 3)
+#define BUTTON_RIGHT (1 << 4)
+#define BUTTON_LEFT (1 << 5)
+#define BUTTON_UP (1 << 6)
+#define BUTTON_DOWN (1 << 7)
+#define BUTTON_R (1 << 8)
+#define BUTTON_L (1 << 9)
+
+/* the interrupt master enable, interrupt enable and interrupt flag registers */
+static volatile unsigned short* const interrupt_enabled = (volatile unsigned short*) 0x4000200;
+static volatile unsigned short* const interrupt_flags = (volatile unsigned short*) 0x4000202;
+static volatile unsigned short* const interrupt_master = (volatile unsigned short*) 0x4000208;
+
+/* the bios checks this copy of the flags to know when to wake from a wait */
+static volatile unsigned short* const interrupt_bios_flags = (volatile unsigned short*) 0x3007FF8;
+
+/* return a pointer to one of the 4 character blocks (0-3) */
+static inline volatile unsigned short* char_block(unsigned long block) {
+    /* they are each 16K big */
+    return (volatile unsigned short*) (0x6000000 + (block * 0x4000));
+}
+
+/* return a pointer to one of the 32 screen blocks (0-31) */
+static inline volatile unsigned short* screen_block(unsigned long block) {
+    /* they are each 2K big */
+    return (volatile unsigned short*) (0x6000000 + (block * 0x800));
+}
+
+/* compute a 16-bit integer color based on the three components */
+static inline unsigned short make_color(unsigned char r, unsigned char g, unsigned char b) {
+    return ((b & 0x1f) << 10) | ((g & 0x1f) << 5) | (r & 0x1f);
+}
+
+#endif
@@ -0,0 +1,77 @@
+/*
+ * input.c
+ * a once per frame snapshot of the buttons
+ */
+
+#include "gba.h"
+#include "interrupt.h"
+#include "input.h"
+
+/* the number of buttons */
+#define NUM_KEYS 10
+
+/* key control bits to raise the key interrupt when any chosen key is down */
+#define KEY_IRQ (1 << 14)
+
+/* the buttons down this frame and last frame, 1 meaning down */
+static unsigned short current, previous;
+
+/* the buttons repeating this frame */
+static unsigned short repeating;
+
+/* frames each button has been held, and the repeat timing */
+static unsigned short held_frames[NUM_KEYS];
+static unsigned short repeat_delay = 20;
+static unsigned short repeat_rate = 4;
+
+void input_update() {
+    previous = current;
+
+    /* the register has a 0 bit for each button which is down */
+    current = ~*buttons & ALL_BUTTONS;
+
+    repeating = 0;
+    for (int i = 0; i < NUM_KEYS; i++) {
+        if (!(current & (1 << i))) {
+            held_frames[i] = 0;
+            continue;
+        }
+
+        held_frames[i]++;
+        if (held_frames[i] >= repeat_delay &&
+                (held_frames[i] - repeat_delay) % repeat_rate == 0) {
+            repeating |= 1 << i;
+        }
+    }
+}
+
+unsigned short key_held(unsigned short keys) {
+    return current & keys;
+}
+
+unsigned short key_hit(unsigned short keys) {
+    return current & ~previous & keys;
+}
+
+unsigned short key_released(unsigned short keys) {
+    return ~current & previous & keys;
+}
+
+unsigned short key_repeat(unsigned short keys) {
+    return (key_hit(keys) | repeating) & keys;
+}
+
+void input_set_repeat(unsigned short delay, unsigned short rate) {
+    repeat_delay = delay;
+    repeat_rate = rate ? rate : 1;
+}
+
+void input_wake_on_keys(unsigned short keys) {
+    if (keys) {
+        *key_control = KEY_IRQ | (keys & ALL_BUTTONS);
+        interrupt_enable(INTERRUPT_KEY);
+    } else {
+        interrupt_disable(INTERRUPT_KEY);
+        *key_control = 0;
+    }
+}
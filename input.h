@@ -0,0 +1,40 @@
+/*
+ * input.h
+ * a once per frame snapshot of the buttons
+ *
+ * call input_update once a frame, then every check during that frame sees
+ * the same state without reading the button register again - the keys
+ * arguments below are BUTTON_ constants from gba.h, ORed together for any
+ * of several buttons
+ */
+
+#ifndef INPUT_H
+#define INPUT_H
+
+/* all of the button bits */
+#define ALL_BUTTONS 0x3ff
+
+/* read the button register into the snapshot, once a frame */
+void input_update();
+
+/* which of keys are down this frame */
+unsigned short key_held(unsigned short keys);
+
+/* which of keys went down this frame */
+unsigned short key_hit(unsigned short keys);
+
+/* which of keys came up this frame */
+unsigned short key_released(unsigned short keys);
+
+/* which of keys went down this frame, or have been held long enough to
+ * repeat this frame */
+unsigned short key_repeat(unsigned short keys);
+
+/* held keys first repeat after delay frames, then every rate frames */
+void input_set_repeat(unsigned short delay, unsigned short rate);
+
+/* raise the key interrupt when any of keys is pressed, so a program can
+ * halt with interrupt_wait until there is input, 0 turns it off */
+void input_wake_on_keys(unsigned short keys);
+
+#endif
@@ -0,0 +1,139 @@
+/*
+ * interrupt.c
+ * shared interrupt handling for the gba programs
+ */
+
+#include "gba.h"
+#include "interrupt.h"
+
+/* the display status bits which make the display raise each interrupt */
+#define STATUS_VBLANK_IRQ (1 << 3)
+#define STATUS_HBLANK_IRQ (1 << 4)
+#define STATUS_VCOUNT_IRQ (1 << 5)
+
+volatile unsigned int vblank_count = 0;
+
+/* the handlers programs have installed for each interrupt */
+static intrp handlers[INTERRUPT_COUNT];
+
+/* acknowledge an interrupt then pass it on to its handler */
+static void interrupt_dispatch(int source) {
+    /* writing a 1 clears the flag, writing 0 to the others leaves them */
+    *interrupt_flags = 1 << source;
+    *interrupt_bios_flags |= 1 << source;
+
+    if (handlers[source]) {
+        handlers[source]();
+    }
+}
+
+static void interrupt_vblank() {
+    vblank_count++;
+    interrupt_dispatch(INTERRUPT_VBLANK);
+}
+
+static void interrupt_hblank() { interrupt_dispatch(INTERRUPT_HBLANK); }
+static void interrupt_vcount() { interrupt_dispatch(INTERRUPT_VCOUNT); }
+static void interrupt_timer0() { interrupt_dispatch(INTERRUPT_TIMER0); }
+static void interrupt_timer1() { interrupt_dispatch(INTERRUPT_TIMER1); }
+static void interrupt_timer2() { interrupt_dispatch(INTERRUPT_TIMER2); }
+static void interrupt_timer3() { interrupt_dispatch(INTERRUPT_TIMER3); }
+static void interrupt_serial() { interrupt_dispatch(INTERRUPT_SERIAL); }
+static void interrupt_dma0() { interrupt_dispatch(INTERRUPT_DMA0); }
+static void interrupt_dma1() { interrupt_dispatch(INTERRUPT_DMA1); }
+static void interrupt_dma2() { interrupt_dispatch(INTERRUPT_DMA2); }
+static void interrupt_dma3() { interrupt_dispatch(INTERRUPT_DMA3); }
+static void interrupt_key() { interrupt_dispatch(INTERRUPT_KEY); }
+
+/* this table specifies which interrupts we handle which way, each entry
+ * acknowledges its interrupt and calls the installed handler if any */
+const intrp IntrTable[INTERRUPT_COUNT] = {
+    interrupt_vblank,   /* V Blank interrupt */
+    interrupt_hblank,   /* H Blank interrupt */
+    interrupt_vcount,   /* V Counter interrupt */
+    interrupt_timer0,   /* Timer 0 interrupt */
+    interrupt_timer1,   /* Timer 1 interrupt */
+    interrupt_timer2,   /* Timer 2 interrupt */
+    interrupt_timer3,   /* Timer 3 interrupt */
+    interrupt_serial,   /* Serial communication interrupt */
+    interrupt_dma0,     /* DMA 0 interrupt */
+    interrupt_dma1,     /* DMA 1 interrupt */
+    interrupt_dma2,     /* DMA 2 interrupt */
+    interrupt_dma3,     /* DMA 3 interrupt */
+    interrupt_key,      /* Key interrupt */
+};
+
+void interrupt_init() {
+    /* nothing may fire while the table is being set up */
+    *interrupt_master = 0;
+
+    for (int i = 0; i < INTERRUPT_COUNT; i++) {
+        handlers[i] = 0;
+    }
+    *interrupt_enabled = 0;
+    *interrupt_flags = 0xffff;
+
+    /* wait_vblank depends on the vblank interrupt so it is always on */
+    interrupt_enable(INTERRUPT_VBLANK);
+
+    *interrupt_master = 1;
+}
+
+void interrupt_set_handler(int source, intrp handler) {
+    handlers[source] = handler;
+}
+
+void interrupt_enable(int source) {
+    /* the display interrupts must also be requested from the display */
+    switch (source) {
+        case INTERRUPT_VBLANK:
+            *display_status |= STATUS_VBLANK_IRQ;
+            break;
+        case INTERRUPT_HBLANK:
+            *display_status |= STATUS_HBLANK_IRQ;
+            break;
+        case INTERRUPT_VCOUNT:
+            *display_status |= STATUS_VCOUNT_IRQ;
+            break;
+    }
+    *interrupt_enabled |= 1 << source;
+}
+
+void interrupt_disable(int source) {
+    *interrupt_enabled &= ~(1 << source);
+
+    switch (source) {
+        case INTERRUPT_VBLANK:
+            *display_status &= ~STATUS_VBLANK_IRQ;
+            break;
+        case INTERRUPT_HBLANK:
+            *display_status &= ~STATUS_HBLANK_IRQ;
+            break;
+        case INTERRUPT_VCOUNT:
+            *display_status &= ~STATUS_VCOUNT_IRQ;
+            break;
+    }
+}
+
+/* wait for the screen to be fully drawn so we can do something during vblank
+ * this uses the bios VBlankIntrWait call which halts the cpu until the next
+ * vblank interrupt, so it never returns part way through a vblank */
+void wait_vblank() {
+#if defined(__thumb__)
+    asm volatile("swi 0x05" ::: "r0", "r1", "r2", "r3", "memory");
+#else
+    asm volatile("swi 0x050000" ::: "r0", "r1", "r2", "r3", "memory");
+#endif
+}
+
+/* this uses the bios IntrWait call, the first argument of 1 makes it ignore
+ * interrupts which happened before the call */
+void interrupt_wait(unsigned short mask) {
+    register unsigned int discard asm("r0") = 1;
+    register unsigned int flags asm("r1") = mask;
+#if defined(__thumb__)
+    asm volatile("swi 0x04" : "+r"(discard), "+r"(flags) :: "r2", "r3", "memory");
+#else
+    asm volatile("swi 0x040000" : "+r"(discard), "+r"(flags) :: "r2", "r3", "memory");
+#endif
+}
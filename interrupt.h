@@ -0,0 +1,51 @@
+/*
+ * interrupt.h
+ * shared interrupt handling for the gba programs
+ *
+ * this module owns the IntrTable the start up code jumps through, so any
+ * program which links interrupt.c must not define its own table
+ */
+
+#ifndef INTERRUPT_H
+#define INTERRUPT_H
+
+/* the interrupt sources, numbered by their bit in the interrupt registers */
+#define INTERRUPT_VBLANK 0
+#define INTERRUPT_HBLANK 1
+#define INTERRUPT_VCOUNT 2
+#define INTERRUPT_TIMER0 3
+#define INTERRUPT_TIMER1 4
+#define INTERRUPT_TIMER2 5
+#define INTERRUPT_TIMER3 6
+#define INTERRUPT_SERIAL 7
+#define INTERRUPT_DMA0 8
+#define INTERRUPT_DMA1 9
+#define INTERRUPT_DMA2 10
+#define INTERRUPT_DMA3 11
+#define INTERRUPT_KEY 12
+#define INTERRUPT_COUNT 13
+
+/* an interrupt handler takes nothing and returns nothing */
+typedef void (*intrp)();
+
+/* the number of vblanks since interrupt_init was called */
+extern volatile unsigned int vblank_count;
+
+/* turn on interrupts with the vblank interrupt enabled, call this first */
+void interrupt_init();
+
+/* set the function called when an interrupt happens, 0 removes it */
+void interrupt_set_handler(int source, intrp handler);
+
+/* enable or disable one interrupt source */
+void interrupt_enable(int source);
+void interrupt_disable(int source);
+
+/* halt the cpu until the start of the next vblank */
+void wait_vblank();
+
+/* halt the cpu until one of the interrupts in mask, a set of
+ * 1 << INTERRUPT_ bits, next happens */
+void interrupt_wait(unsigned short mask);
+
+#endif
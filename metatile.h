@@ -0,0 +1,64 @@
+/*
+ * metatile.h
+ * world maps stored as 2x2 groups of tiles
+ *
+ * a metatile holds the tile map entries of both the visible layer and the
+ * boundary layer for a 2x2 block, plus the collision kind of each of its 4
+ * tiles, so a map is one byte per block and repeated blocks are stored once
+ * the headers are made from a visible and a boundary tile map by metagen
+ */
+
+#ifndef METATILE_H
+#define METATILE_H
+
+/* a metatile covers 2x2 tiles */
+#define METATILE_SIZE 2
+
+/* the layers held in a metatile */
+#define METATILE_VISIBLE 0
+#define METATILE_BOUNDARY 1
+#define METATILE_LAYERS 2
+
+/* the tile map entries of each layer, top left, top right, bottom left,
+ * bottom right */
+struct Metatile {
+    unsigned short tiles[METATILE_LAYERS][METATILE_SIZE * METATILE_SIZE];
+};
+
+/* a world map made of metatiles */
+struct MetatileMap {
+    /* the distinct metatiles */
+    const struct Metatile* metatiles;
+
+    /* the collision kind (0-3) of each tile of each metatile, 2 bits per
+     * tile in the same order as the tiles, top left in the low bits */
+    const unsigned char* collision;
+
+    /* which metatile is at each position, row major */
+    const unsigned char* map;
+
+    /* size of the map in metatiles, it is twice that in tiles */
+    unsigned short width, height;
+};
+
+/* the position of tile x, y within its metatile, 0-3 */
+static inline int metatile_corner(int x, int y) {
+    return ((y & 1) << 1) | (x & 1);
+}
+
+/* the metatile index covering tile x, y, which must be within the map */
+static inline int metatile_index(const struct MetatileMap* world, int x, int y) {
+    return world->map[(y >> 1) * world->width + (x >> 1)];
+}
+
+/* the tile map entry of one layer at tile x, y */
+static inline unsigned short metatile_tile(const struct MetatileMap* world, int layer, int x, int y) {
+    return world->metatiles[metatile_index(world, x, y)].tiles[layer][metatile_corner(x, y)];
+}
+
+/* the collision kind at tile x, y */
+static inline unsigned int metatile_collision(const struct MetatileMap* world, int x, int y) {
+    return (world->collision[metatile_index(world, x, y)] >> (metatile_corner(x, y) << 1)) & 3;
+}
+
+#endif
@@ -3,74 +3,11 @@
  **/
 
 #include <stdlib.h>
-/* the width and height of the screen */
-#define WIDTH 240
-#define HEIGHT 160
-
-/* these identifiers define different bit positions of the display control */
-#define MODE4 0x0004
-#define BG2 0x0400
-
-/* this bit indicates whether to display the front or the back buffer
- * this allows us to refer to bit 4 of the display_control register */
-#define SHOW_BACK 0x10;
-
-/* the screen is simply a pointer into memory at a specific address this
- *  * pointer points to 16-bit colors of which there are 240x160 */
-volatile unsigned short* screen = (volatile unsigned short*) 0x6000000;
-
-/* the display control pointer points to the gba graphics register */
-volatile unsigned long* display_control = (volatile unsigned long*) 0x4000000;
-
-/* the address of the color palette used in graphics mode 4 */
-volatile unsigned short* palette = (volatile unsigned short*) 0x5000000;
-
-/* pointers to the front and back buffers - the front buffer is the start
- * of the screen array and the back buffer is a pointer to the second half */
-volatile unsigned short* front_buffer = (volatile unsigned short*) 0x6000000;
-volatile unsigned short* back_buffer = (volatile unsigned short*)  0x600A000;
-
-/* the button register holds the bits which indicate whether each button has
- * been pressed - this has got to be volatile as well
- */
-volatile unsigned short* buttons = (volatile unsigned short*) 0x04000130;
-
-/* the bit positions indicate each button - the first bit is for A, second for
- * B, and so on, each constant below can be ANDED into the register to get the
- * status of any one button */
-#define BUTTON_A (1 << 0)
-#define BUTTON_B (1 << 1)
-#define BUTTON_SELECT (1 << 2)
-#define BUTTON_START (1 << 3)
-#define BUTTON_RIGHT (1 << 4)
-#define BUTTON_LEFT (1 << 5)
-#define BUTTON_UP (1 << 6)
-#define BUTTON_DOWN (1 << 7)
-#define BUTTON_R (1 << 8)
-#define BUTTON_L (1 << 9)
-
-/* the scanline counter is a memory cell which is updated to indicate how
- * much of the screen has been drawn */
-volatile unsigned short* scanline_counter = (volatile unsigned short*) 0x4000006;
-
-/* wait for the screen to be fully drawn so we can do something during vblank */
-void wait_vblank() {
-    /* wait until all 160 lines have been updated */
-    while (*scanline_counter < 160) { }
-}
-
-/* this function checks whether a particular button has been pressed */
-unsigned char button_pressed(unsigned short button) {
-    /* and the button register with the button constant we want */
-    unsigned short pressed = *buttons & button;
-
-    /* if this value is zero, then it's not pressed */
-    if (pressed == 0) {
-        return 1;
-    } else {
-        return 0;
-    }
-}
+#include "gba.h"
+#include "bitmap.h"
+#include "dma.h"
+#include "input.h"
+#include "interrupt.h"
 
 /* keep track of the next palette index */
 int next_palette_index = 0;
@@ -85,7 +22,7 @@ unsigned char add_color(unsigned char r, unsigned char g, unsigned char b) {
     color += r;
 
     /* add the color to the palette */
-    palette[next_palette_index] = color;
+    bg_palette[next_palette_index] = color;
 
     /* increment the index */
     next_palette_index++;
@@ -101,10 +38,29 @@ struct paddle {
     unsigned short width;
 };
 
+/* 16.16 fixed point numbers, the top 16 bits are whole pixels and the
+ * bottom 16 bits are the fraction of a pixel */
+typedef int fixed;
+#define FIXED_SHIFT 16
+#define FIXED_ONE (1 << FIXED_SHIFT)
+
+/* the ball starts out moving 1 pixel every 5 frames on each axis */
+#define BALL_SPEED (FIXED_ONE / 5)
+
+/* the fastest the ball may move on each axis, in pixels per frame */
+#define BALL_MAX_SPEED (4 * FIXED_ONE)
+
+/* how many frames the ball waits in the middle after a point */
+#define SERVE_FRAMES 60
+
 struct ball
 {
+    /* the whole pixel position the ball is drawn at */
     unsigned short x, y, size;
     unsigned char color;
+
+    /* the exact position, and the velocity in pixels per frame */
+    fixed fx, fy, vx, vy;
 };
 
 struct playerScore
@@ -131,54 +87,148 @@ void put_pixel(volatile unsigned short* buffer, int row, int col, unsigned char
     }
 }
 
-/* draw a paddle onto the screen */
-void draw_paddle(volatile unsigned short* buffer, struct paddle* p) {
-    short row, col;
-    /* for each row of the paddle */
-    for (row = p->y; row < (p->y + p->length); row++) {
-        /* loop through each column of the paddle */
-        for (col = p->x; col < (p->x + p->width); col++) {
-            /* set the screen location to this color */
-            put_pixel(buffer, row, col, p->color);
+/* fill a rectangle of a mode 4 buffer with one color, clipped to the screen
+ * vram can only be written 16 bits at a time, so only an odd pixel at either
+ * end of a row needs put_pixel's read-modify-write, the pixels between are
+ * written two or four at a time without reading anything back */
+void fill_rect(volatile unsigned short* buffer, int row, int col, int height, int width, unsigned char color) {
+    /* clip the rectangle to the screen */
+    if (row < 0) {
+        height += row;
+        row = 0;
+    }
+    if (col < 0) {
+        width += col;
+        col = 0;
+    }
+    if (row + height > HEIGHT) {
+        height = HEIGHT - row;
+    }
+    if (col + width > WIDTH) {
+        width = WIDTH - col;
+    }
+    if (height <= 0 || width <= 0) {
+        return;
+    }
+
+    /* the color repeated to fill a halfword and a word */
+    unsigned short pair = color | (color << 8);
+    unsigned int quad = pair | (pair << 16);
+
+    for (int r = row; r < row + height; r++) {
+        /* the columns still to fill are left up to but not including right */
+        int left = col;
+        int right = col + width;
+
+        /* an odd first pixel shares its halfword with the pixel before it */
+        if (left & 1) {
+            put_pixel(buffer, r, left, color);
+            left++;
+        }
+
+        /* an even last pixel shares its halfword with the pixel after it */
+        if ((right & 1) && left < right) {
+            put_pixel(buffer, r, right - 1, color);
+            right--;
+        }
+
+        /* now left and right are even, so the rest are whole halfwords */
+        volatile unsigned short* dest = buffer + ((r * WIDTH + left) >> 1);
+        int halves = (right - left) >> 1;
+
+        /* one halfword to get onto a word boundary, then whole words */
+        if (halves > 0 && ((unsigned int) dest & 2)) {
+            *dest++ = pair;
+            halves--;
+        }
+        volatile unsigned int* words = (volatile unsigned int*) dest;
+        for (; halves >= 2; halves -= 2) {
+            *words++ = quad;
+        }
+        if (halves) {
+            *(volatile unsigned short*) words = pair;
         }
     }
 }
 
-/* draw a playing ball onto the screen */
-void draw_ball(volatile unsigned short* buffer, struct ball* b)
-{
-    short row, col;
-    for (row = b -> y; row < (b -> y + b -> size); row++)
-    {
-        for (col = b -> x; col < (b -> x + b -> size); col++)
-        {
-            put_pixel(buffer, row, col, b -> color);
-        }
+/* a rectangle of the screen in pixels */
+struct rect {
+    short row, col, height, width;
+};
+
+/* the most rectangles drawn into one page in a frame */
+#define MAX_DIRTY 8
+
+/* the rectangles drawn into each page since it was last erased, index 0 is
+ * the front buffer and 1 the back buffer - each page is only drawn every
+ * other frame, so it has to remember its own list rather than share one */
+struct rect dirty_rects[2][MAX_DIRTY];
+short dirty_count[2];
+
+/* set when a page had more than MAX_DIRTY rectangles, it is cleared whole */
+unsigned char dirty_overflow[2];
+
+/* return which page a buffer is */
+int page_index(volatile unsigned short* buffer) {
+    return buffer == front_buffer ? 0 : 1;
+}
+
+/* fill a rectangle and remember it so it is erased next time this page is used */
+void draw_rect(volatile unsigned short* buffer, int row, int col, int height, int width, unsigned char color) {
+    int page = page_index(buffer);
+
+    if (dirty_count[page] < MAX_DIRTY) {
+        struct rect* r = &dirty_rects[page][dirty_count[page]++];
+        r->row = row;
+        r->col = col;
+        r->height = height;
+        r->width = width;
+    } else {
+        dirty_overflow[page] = 1;
     }
+
+    fill_rect(buffer, row, col, height, width, color);
 }
 
-/* clear the screen right around the paddle */
-void update_screen(volatile unsigned short* buffer, unsigned short color, struct paddle* p) {
-    short row, col;
-    for (row = p->y - 2; row < (p->y + p->length + 2); row++) {
-        for (col = p->x; col < (p->x + p->width); col++) {
-            put_pixel(buffer, row, col, color);
+/* erase exactly what was drawn into this page the last time it was used */
+void erase_dirty(volatile unsigned short* buffer, unsigned char color) {
+    int page = page_index(buffer);
+
+    if (dirty_overflow[page]) {
+        mode4_clear(buffer, color);
+    } else {
+        for (int i = 0; i < dirty_count[page]; i++) {
+            struct rect* r = &dirty_rects[page][i];
+            fill_rect(buffer, r->row, r->col, r->height, r->width, color);
         }
     }
+
+    dirty_count[page] = 0;
+    dirty_overflow[page] = 0;
 }
 
-void update_ball(volatile unsigned short* buffer, unsigned short color, struct ball* b)
-{
-    short row, col;
-    for (row = b -> y - 2; row < (b -> y + b -> size + 2); row++)
-    {
-        for (col = b -> x - 2; col < (b -> x + b -> size + 2); col++)
-        {
-            put_pixel(buffer, row, col, color);
-        }
+/* clear both pages, which leaves nothing to erase */
+void clear_pages(unsigned char color) {
+    mode4_clear(front_buffer, color);
+    mode4_clear(back_buffer, color);
+
+    for (int page = 0; page < 2; page++) {
+        dirty_count[page] = 0;
+        dirty_overflow[page] = 0;
     }
 }
 
+/* draw a paddle onto the screen */
+void draw_paddle(volatile unsigned short* buffer, struct paddle* p) {
+    draw_rect(buffer, p->y, p->x, p->length, p->width, p->color);
+}
+
+/* draw a playing ball onto the screen */
+void draw_ball(volatile unsigned short* buffer, struct ball* b)
+{
+    draw_rect(buffer, b -> y, b -> x, b -> size, b -> size, b -> color);
+}
+
 /* this function takes a video buffer and returns to you the other one */
 volatile unsigned short* flip_buffers(volatile unsigned short* buffer) {
     /* if the back buffer is up, return that */
@@ -193,28 +243,111 @@ volatile unsigned short* flip_buffers(volatile unsigned short* buffer) {
     }
 }
 
+/* set to 1 to draw the paddles and ball as hardware sprites over a static
+ * mode 4 playfield, or 0 to draw them into the mode 4 pages every frame */
+#define USE_SPRITES 1
+
+/* one sprite's attributes, laid out as they are in sprite attribute memory */
+struct sprite {
+    unsigned short attribute0, attribute1, attribute2, attribute3;
+};
+
+/* the number of sprites the hardware has */
+#define NUM_SPRITES 128
+
+/* the sprites pong uses */
+#define SPRITE_LEFT 0
+#define SPRITE_RIGHT 1
+#define SPRITE_BALL 2
+#define PONG_SPRITES 3
+
+/* in the bitmap modes the screen uses the first half of sprite image memory,
+ * so sprite tiles start at tile 512 - each 256 color tile takes two numbers */
+#define SPRITE_TILE_BASE 512
+#define BALL_TILE SPRITE_TILE_BASE
+#define PADDLE_TILE (SPRITE_TILE_BASE + 2)
+
+/* the sprite palette entry the paddles and ball are drawn with, 0 is clear */
+#define SPRITE_COLOR 1
+
+/* attribute bits for 256 colors, a hidden sprite, and the sprite shapes */
+#define SPRITE_256_COLOR (1 << 13)
+#define SPRITE_HIDE (1 << 9)
+#define SPRITE_SQUARE (0 << 14)
+#define SPRITE_TALL (2 << 14)
+
+/* the sprites are changed here during the frame and copied into sprite
+ * attribute memory during vblank, when it is safe to write */
+struct sprite sprite_shadow[PONG_SPRITES];
+
+/* draw a width by height block into a 256 color sprite image of 8 pixel
+ * wide tiles, the image is in 1D order so each tile follows the one above */
+void sprite_block(unsigned char* image, int width, int height) {
+    for (int row = 0; row < height; row++) {
+        for (int col = 0; col < width; col++) {
+            image[(row / 8) * 64 + (row % 8) * 8 + col] = SPRITE_COLOR;
+        }
+    }
+}
+
+/* load the paddle and ball images and set up their sprites */
+void setup_sprites(struct paddle* p, struct ball* b, unsigned char color) {
+    /* an 8x8 ball image and an 8x16 paddle image, both from 8x8 tiles */
+    unsigned char ball_image[64] = {0};
+    unsigned char paddle_image[128] = {0};
+
+    sprite_block(ball_image, b->size, b->size);
+    sprite_block(paddle_image, p->width, p->length);
+    dma_copy(sprite_image_memory + BALL_TILE * 16, ball_image, sizeof(ball_image));
+    dma_copy(sprite_image_memory + PADDLE_TILE * 16, paddle_image, sizeof(paddle_image));
+
+    /* the sprites use the same color as the bitmap renderer */
+    sprite_palette[SPRITE_COLOR] = bg_palette[color];
+
+    /* hide every sprite, then turn on the three we use */
+    for (int i = 0; i < NUM_SPRITES; i++) {
+        sprite_attribute_memory[i * 4] = SPRITE_HIDE;
+    }
+    sprite_shadow[SPRITE_LEFT].attribute0 = SPRITE_256_COLOR | SPRITE_TALL;
+    sprite_shadow[SPRITE_LEFT].attribute1 = 0;
+    sprite_shadow[SPRITE_LEFT].attribute2 = PADDLE_TILE;
+    sprite_shadow[SPRITE_RIGHT] = sprite_shadow[SPRITE_LEFT];
+    sprite_shadow[SPRITE_BALL].attribute0 = SPRITE_256_COLOR | SPRITE_SQUARE;
+    sprite_shadow[SPRITE_BALL].attribute1 = 0;
+    sprite_shadow[SPRITE_BALL].attribute2 = BALL_TILE;
+
+    *display_control |= SPRITE_ENABLE | SPRITE_MAP_1D;
+}
+
+/* move a sprite in the shadow copy */
+void sprite_position(struct sprite* sprite, int x, int y) {
+    sprite->attribute0 = (sprite->attribute0 & 0xff00) | (y & 0xff);
+    sprite->attribute1 = (sprite->attribute1 & 0xfe00) | (x & 0x1ff);
+}
+
+/* put the paddles and ball sprites where the objects are */
+void render_sprites(struct paddle* left, struct paddle* right, struct ball* b) {
+    sprite_position(&sprite_shadow[SPRITE_LEFT], left->x, left->y);
+    sprite_position(&sprite_shadow[SPRITE_RIGHT], right->x, right->y);
+    sprite_position(&sprite_shadow[SPRITE_BALL], b->x, b->y);
+}
+
+/* copy the shadow sprites into sprite attribute memory, call during vblank */
+void upload_sprites() {
+    dma_copy(sprite_attribute_memory, sprite_shadow, sizeof(sprite_shadow));
+}
+
 /* handle the buttons which are pressed down */
 void handle_buttons(struct paddle* p) {
     /* move the paddle with the arrow keys */	
-	if (button_pressed(BUTTON_DOWN) && ((p->y + p->length) < HEIGHT)) {
+	if (key_held(BUTTON_DOWN) && ((p->y + p->length) < HEIGHT)) {
 		p->y++;
 	}
-	if (button_pressed(BUTTON_UP) && (p->y > 0)) {
+	if (key_held(BUTTON_UP) && (p->y > 0)) {
 		p->y--;
 	}
 }
 
-/* clear the screen to black */
-void clear_screen(volatile unsigned short* buffer, unsigned short color) {
-    unsigned short row, col;
-    /* set each pixel black */
-    for (row = 0; row < HEIGHT; row++) {
-        for (col = 0; col < WIDTH; col++) {
-            put_pixel(buffer, row, col, color);
-        }
-    }
-}
-
 /* tracking AI - not finished*/
 void trackAI(struct paddle* p, struct ball* b)
 {
@@ -266,13 +399,8 @@ void basicAI(struct paddle* p)
     }
 }
 
-short quadrant, dx, dy;
-/* moves the ball */
-void ballMove(struct ball* b)
-{
-    b -> x += dx;
-    b -> y += dy;
-}
+/* frames left before the ball is served */
+short serveDelay = 0;
 
 /* records the score for both the player and computer as well as incrementing score. */
 void scoreKeeper(struct playerScore* p)
@@ -280,103 +408,132 @@ void scoreKeeper(struct playerScore* p)
     p -> score++;
 }
 
-/* resets the paddle and ball position as well as game speed (implement later) after a score. */
+/* spawns the ball in the center of the screen and randomly select a quadrant to play the ball. */
+void startBall(struct ball* b)
+{
+    b -> x = 119;
+    b -> y = 79;
+    b -> fx = b -> x << FIXED_SHIFT;
+    b -> fy = b -> y << FIXED_SHIFT;
+    b -> vx = (rand() & 1) ? BALL_SPEED : -BALL_SPEED;
+    b -> vy = (rand() & 2) ? BALL_SPEED : -BALL_SPEED;
+}
+
+/* resets the paddle and ball position as well as game speed after a score. */
 void resetState(struct paddle* left, struct paddle* right, struct ball* b, unsigned char color)
 {
     left -> x = 35;
     left -> y = 75;
     right -> x = 205;
     right -> y = 75;
-    
-    quadrant = rand() % 4;
-    switch (quadrant)
-    {
-        case 0:
-            dx = -1;
-            dy = 1;
-            break;
-        case 1:
-            dx = 1;
-            dy = 1;
-            break;
-        case 2:
-            dx = -1;
-            dy = -1;
-            break;
-        default:
-            dx = 1;
-            dy = -1;
-    }
-    b -> x = 119;
-    b -> y = 79;
-    
-    clear_screen(front_buffer, color);
-    clear_screen(back_buffer, color);
+
+    startBall(b);
+    serveDelay = SERVE_FRAMES;
+
+    clear_pages(color);
+}
+
+/* keep a speed within the limit in either direction */
+fixed clampSpeed(fixed v)
+{
+    if (v > BALL_MAX_SPEED) return BALL_MAX_SPEED;
+    if (v < -BALL_MAX_SPEED) return -BALL_MAX_SPEED;
+    return v;
+}
+
+/* the leading edge of the ball moved from lead0 to lead1 this step, crossing
+ * the face of a paddle - find where the ball was when it reached the face and
+ * check it was level with the paddle then, which works no matter how far
+ * the ball moved in one step */
+int sweptHit(struct ball* b, fixed y0, fixed lead0, fixed lead1, fixed face, struct paddle* p)
+{
+    /* how far through the step the face was reached, from 0 to FIXED_ONE */
+    fixed t = (fixed) (((long long) (face - lead0) << FIXED_SHIFT) / (lead1 - lead0));
+    fixed y = y0 + (fixed) (((long long) (b -> fy - y0) * t) >> FIXED_SHIFT);
+    int top = y >> FIXED_SHIFT;
+
+    return (top + b -> size > p -> y) && (top < p -> y + p -> length);
+}
+
+/* send the ball back off a paddle, a bit faster, at an angle depending on
+ * how far from the middle of the paddle it hit */
+void bounce(struct ball* b, struct paddle* p)
+{
+    fixed speed = b -> vx < 0 ? -b -> vx : b -> vx;
+    int offset = (b -> fy >> FIXED_SHIFT) + b -> size / 2 - (p -> y + p -> length / 2);
+
+    speed = clampSpeed(speed + (speed >> 4));
+    b -> vx = b -> vx < 0 ? speed : -speed;
+    b -> vy = clampSpeed((offset * speed) / (p -> length / 2));
 }
 
-/* check the position of the ball and perform an action based on the condition of the ball. */
-void ballCollision(struct ball* b, struct playerScore* p1, struct playerScore* p2, struct paddle* left, struct paddle* right, unsigned char color)
+/* move the ball by the frames which passed, bounce it off the walls and
+ * paddles, and score a point if it leaves the screen */
+void ballUpdate(struct ball* b, int frames, struct playerScore* p1, struct playerScore* p2, struct paddle* left, struct paddle* right, unsigned char color)
 {
-	int x;
-    switch(b -> x)
+    fixed size = b -> size << FIXED_SHIFT;
+
+    if (serveDelay > 0)
     {
-        case (WIDTH - 1):
-            scoreKeeper(p1);
-            resetState(left, right, b, color);
-			for(x = 0; x < 65535; x++)
-			{
-				//Do nothing.
-			}	
-            break;
-        case 0:
-            scoreKeeper(p2);
-            resetState(left, right, b, color);
-			for(x = 0; x < 65535; x++)
-			{
-				//Do nothing.
-			}	
-            break;
+        serveDelay -= frames;
+        return;
     }
-    
-    switch(b -> y)
+
+    fixed x0 = b -> fx;
+    fixed y0 = b -> fy;
+    b -> fx += b -> vx * frames;
+    b -> fy += b -> vy * frames;
+
+    /* bounce off the top and bottom by reflecting the overshoot */
+    if (b -> fy < 0)
     {
-        case (HEIGHT - 1):
-        case 0:
-            dy *= -1;
-            break;
+        b -> fy = -b -> fy;
+        b -> vy = -b -> vy;
+    }
+    else if (b -> fy + size > (HEIGHT << FIXED_SHIFT))
+    {
+        b -> fy = 2 * ((HEIGHT << FIXED_SHIFT) - size) - b -> fy;
+        b -> vy = -b -> vy;
     }
-    
-    // if the ball is in contact with the paddle, reverse the momentum of the ball in the x-axis.
-    if(((b -> x == (left -> x + left -> width)) && ((b -> y >= left -> y) && (b -> y <= (left -> y + left -> length)))) || 
-    ((b -> x == right -> x) && ((b -> y >= right -> y) && (b -> y <= (right -> y + right -> length))))) dx *= -1;
-}
 
-/* spawns the ball in the center of the screen and randomly select a quadrant to play the ball. */
-void startBall()
-{
-    quadrant = rand() % 4;
-    switch (quadrant)
+    /* the left paddle is hit by the left side of the ball, the right paddle
+     * by the right side of the ball */
+    fixed leftFace = (left -> x + left -> width) << FIXED_SHIFT;
+    fixed rightFace = right -> x << FIXED_SHIFT;
+    if (b -> vx < 0 && x0 >= leftFace && b -> fx < leftFace &&
+        sweptHit(b, y0, x0, b -> fx, leftFace, left))
+    {
+        b -> fx = 2 * leftFace - b -> fx;
+        bounce(b, left);
+    }
+    else if (b -> vx > 0 && x0 + size <= rightFace && b -> fx + size > rightFace &&
+        sweptHit(b, y0, x0 + size, b -> fx + size, rightFace, right))
+    {
+        b -> fx = 2 * (rightFace - size) - b -> fx;
+        bounce(b, right);
+    }
+
+    /* leaving either side of the screen scores for the other player */
+    if (b -> fx + size >= (WIDTH << FIXED_SHIFT))
+    {
+        scoreKeeper(p1);
+        resetState(left, right, b, color);
+    }
+    else if (b -> fx <= 0)
     {
-        case 0:
-            dx = -1;
-            dy = 1;
-            break;
-        case 1:
-            dx = 1;
-            dy = 1;
-            break;
-        case 2:
-            dx = -1;
-            dy = -1;
-            break;
-        default:
-            dx = 1;
-            dy = -1;
+        scoreKeeper(p2);
+        resetState(left, right, b, color);
     }
+
+    b -> x = b -> fx >> FIXED_SHIFT;
+    b -> y = b -> fy >> FIXED_SHIFT;
 }
 
 /* the main function */
 int main() {
+    /* turn on the vblank interrupt used by wait_vblank */
+    interrupt_init();
+
     /* we set the mode to mode 4 with bg2 on */
     *display_control = MODE4 | BG2;
 
@@ -396,75 +553,61 @@ int main() {
 
     /* the buffer we start with */
     volatile unsigned short* buffer = front_buffer;
-	
-	/* game delay */
-	char gameDelay = 0;
-	
+
+    /* the frame the ball was last moved on */
+    unsigned int lastFrame = vblank_count;
+
     /* clear whole screen first */
-    clear_screen(front_buffer, black);
-    clear_screen(back_buffer, black);
+    clear_pages(black);
     
-    startBall();
+    startBall(&pong);
+
+    /* the sprites sit over the cleared front page, which is never redrawn */
+    if (USE_SPRITES) {
+        setup_sprites(&player, &pong, slateGray);
+    }
 
     /* loop forever */
     while (1) {
-        /* clear the screen - only the areas around the paddle and ball! */
-        update_screen(buffer, black, &player);
-        update_screen(buffer, black, &computer);
-        update_ball(buffer, black, &pong);
-
-        /* draw the paddles and ball */
-        draw_paddle(buffer, &player);
-        draw_paddle(buffer, &computer);
-        draw_ball(buffer, &pong);
-
-        ballCollision(&pong, &player1, &player2, &player, &computer, black);
+        if (USE_SPRITES) {
+            /* moving an object is just a change to its sprite's position */
+            render_sprites(&player, &computer, &pong);
+        } else {
+            /* clear the screen - only what was drawn into this page last time */
+            erase_dirty(buffer, black);
+
+            /* draw the paddles and ball */
+            draw_paddle(buffer, &player);
+            draw_paddle(buffer, &computer);
+            draw_ball(buffer, &pong);
+        }
 
-        /* wait for vblank before switching buffers */
+        /* wait for vblank before switching buffers or updating sprites */
         wait_vblank();
 
+        if (USE_SPRITES) {
+            upload_sprites();
+        }
+
+		/* read the buttons once for the whole frame */
+		input_update();
 		handle_buttons(&player);
 		basicAI(&computer);
 		//trackAI(&computer, &pong);
 
-        /* handle button input */
-		if(gameDelay == 5)
-        {	
-			ballMove(&pong);
-			gameDelay = 0;
-		}
-		gameDelay++;
+        /* move the ball by however many frames have passed, so it keeps
+         * the same speed even if a frame runs long */
+        unsigned int frame = vblank_count;
+        ballUpdate(&pong, frame - lastFrame, &player1, &player2, &player, &computer, black);
+        lastFrame = frame;
 
         /* swap the buffers */
-        buffer = flip_buffers(buffer);
+        if (!USE_SPRITES) {
+            buffer = flip_buffers(buffer);
+        }
     }
 }
 
-/* the game boy advance uses "interrupts" to handle certain situations
- * for now we will ignore these */
-void interrupt_ignore() {
-    /* do nothing */
-}
-
-/* this table specifies which interrupts we handle which way
- * for now, we ignore all of them */
-typedef void (*intrp)();
-const intrp IntrTable[13] = {
-    interrupt_ignore,   /* V Blank interrupt */
-    interrupt_ignore,   /* H Blank interrupt */
-    interrupt_ignore,   /* V Counter interrupt */
-    interrupt_ignore,   /* Timer 0 interrupt */
-    interrupt_ignore,   /* Timer 1 interrupt */
-    interrupt_ignore,   /* Timer 2 interrupt */
-    interrupt_ignore,   /* Timer 3 interrupt */
-    interrupt_ignore,   /* Serial communication interrupt */
-    interrupt_ignore,   /* DMA 0 interrupt */
-    interrupt_ignore,   /* DMA 1 interrupt */
-    interrupt_ignore,   /* DMA 2 interrupt */
-    interrupt_ignore,   /* DMA 3 interrupt */
-    interrupt_ignore,   /* Key interrupt */
-};
-
 
 /*
 1. Implement AI movement. ~done
@@ -0,0 +1,151 @@
+/*
+ * stream.c
+ * streaming a tile map of any size through one 32x32 screen block
+ */
+
+#include "gba.h"
+#include "stream.h"
+
+/* wrap a world coordinate into 0 to size - 1, a mask for power of 2 sizes */
+static inline int stream_wrap(int coord, int size) {
+    if ((size & (size - 1)) == 0) {
+        return coord & (size - 1);
+    }
+    coord %= size;
+    return coord < 0 ? coord + size : coord;
+}
+
+/* the tile map entry at a wrapped world position */
+static inline unsigned short stream_tile(struct StreamMap* stream, int x, int y) {
+    if (stream->world) {
+        return metatile_tile(stream->world, stream->layer, x, y);
+    }
+    return stream->map[y * stream->width + x];
+}
+
+/* copy world column x into the block, for the rows currently held */
+static void stream_column(struct StreamMap* stream, volatile unsigned short* block, int x) {
+    int world_x = stream_wrap(x, stream->width);
+    int ring_x = x & (STREAM_SIZE - 1);
+
+    for (int i = 0; i < STREAM_SIZE; i++) {
+        int y = stream->tile_y + i;
+        block[((y & (STREAM_SIZE - 1)) * STREAM_SIZE) + ring_x] = stream_tile(stream, world_x, stream_wrap(y, stream->height));
+    }
+}
+
+/* copy world row y into the block, for the columns currently held */
+static void stream_row(struct StreamMap* stream, volatile unsigned short* block, int y) {
+    int world_y = stream_wrap(y, stream->height);
+    volatile unsigned short* dest = block + (y & (STREAM_SIZE - 1)) * STREAM_SIZE;
+
+    for (int i = 0; i < STREAM_SIZE; i++) {
+        int x = stream->tile_x + i;
+        dest[x & (STREAM_SIZE - 1)] = stream_tile(stream, stream_wrap(x, stream->width), world_y);
+    }
+}
+
+/* set up the parts common to both kinds of map and fill the whole block */
+static void stream_start(struct StreamMap* stream, int screen_block, int camera_x, int camera_y) {
+    stream->screen_block = screen_block;
+    stream->tile_x = camera_x >> 3;
+    stream->tile_y = camera_y >> 3;
+    stream->column_count = 0;
+    stream->row_count = 0;
+    stream->refresh = 1;
+    stream_commit(stream);
+}
+
+void stream_init(struct StreamMap* stream, const unsigned short* map, int width, int height,
+        int screen_block, int camera_x, int camera_y) {
+    stream->map = map;
+    stream->world = 0;
+    stream->width = width;
+    stream->height = height;
+    stream_start(stream, screen_block, camera_x, camera_y);
+}
+
+void stream_init_metatiles(struct StreamMap* stream, const struct MetatileMap* world, int layer,
+        int screen_block, int camera_x, int camera_y) {
+    stream->map = 0;
+    stream->world = world;
+    stream->layer = layer;
+    stream->width = world->width * METATILE_SIZE;
+    stream->height = world->height * METATILE_SIZE;
+    stream_start(stream, screen_block, camera_x, camera_y);
+}
+
+void stream_scroll(struct StreamMap* stream, int camera_x, int camera_y) {
+    /* shifting rounds down, so negative positions work too */
+    int tile_x = camera_x >> 3;
+    int tile_y = camera_y >> 3;
+    int dx = tile_x - stream->tile_x;
+    int dy = tile_y - stream->tile_y;
+
+    if (stream->refresh) {
+        stream->tile_x = tile_x;
+        stream->tile_y = tile_y;
+        return;
+    }
+
+    /* a jump, such as the camera wrapping round the world, rewrites it all */
+    if (dx >= STREAM_MAX_PENDING || dx <= -STREAM_MAX_PENDING ||
+            dy >= STREAM_MAX_PENDING || dy <= -STREAM_MAX_PENDING) {
+        stream->refresh = 1;
+        stream->tile_x = tile_x;
+        stream->tile_y = tile_y;
+        return;
+    }
+
+    /* moving right exposes the columns past the right edge of what is held,
+     * moving left exposes the columns at the new left edge */
+    for (int x = tile_x; x < stream->tile_x; x++) {
+        stream->columns[stream->column_count++ % STREAM_MAX_PENDING] = x;
+    }
+    for (int x = stream->tile_x + STREAM_SIZE; x < tile_x + STREAM_SIZE; x++) {
+        stream->columns[stream->column_count++ % STREAM_MAX_PENDING] = x;
+    }
+    for (int y = tile_y; y < stream->tile_y; y++) {
+        stream->rows[stream->row_count++ % STREAM_MAX_PENDING] = y;
+    }
+    for (int y = stream->tile_y + STREAM_SIZE; y < tile_y + STREAM_SIZE; y++) {
+        stream->rows[stream->row_count++ % STREAM_MAX_PENDING] = y;
+    }
+
+    stream->tile_x = tile_x;
+    stream->tile_y = tile_y;
+
+    /* too many steps between commits to keep track of one by one */
+    if (stream->column_count > STREAM_MAX_PENDING || stream->row_count > STREAM_MAX_PENDING) {
+        stream->refresh = 1;
+    }
+}
+
+void stream_commit(struct StreamMap* stream) {
+    volatile unsigned short* block = screen_block(stream->screen_block);
+
+    if (stream->refresh) {
+        for (int i = 0; i < STREAM_SIZE; i++) {
+            stream_row(stream, block, stream->tile_y + i);
+        }
+    } else {
+        /* a column or row which has since scrolled back out of the held
+         * area would overwrite tiles still in view, so it is skipped */
+        for (int i = 0; i < stream->column_count; i++) {
+            int x = stream->columns[i];
+            if (x >= stream->tile_x && x < stream->tile_x + STREAM_SIZE) {
+                stream_column(stream, block, x);
+            }
+        }
+        for (int i = 0; i < stream->row_count; i++) {
+            int y = stream->rows[i];
+            if (y >= stream->tile_y && y < stream->tile_y + STREAM_SIZE) {
+                stream_row(stream, block, y);
+            }
+        }
+    }
+
+    stream->column_count = 0;
+    stream->row_count = 0;
+    stream->refresh = 0;
+}
@@ -0,0 +1,66 @@
+/*
+ * stream.h
+ * streaming a tile map of any size through one 32x32 screen block
+ *
+ * the screen block is used as a ring, tile (x, y) of the world always goes
+ * to entry (y & 31, x & 31), so with the background scroll set to the camera
+ * position the hardware wrap shows the right part of the world - as the
+ * camera moves only the newly exposed column or row is copied, during vblank
+ * the world wraps around at its edges
+ */
+
+#ifndef STREAM_H
+#define STREAM_H
+
+#include "metatile.h"
+
+/* the screen block holds 32x32 tiles, the screen shows at most 31x21 */
+#define STREAM_SIZE 32
+
+/* the most columns or rows waiting for vblank before the whole block is
+ * rewritten instead */
+#define STREAM_MAX_PENDING 4
+
+/* one background layer being streamed from a world map */
+struct StreamMap {
+    /* the world tile map, row major, or a metatile map and which of its
+     * layers to show, and the size of the world in tiles */
+    const unsigned short* map;
+    const struct MetatileMap* world;
+    int layer;
+    int width, height;
+
+    /* the screen block (0-31) the layer is drawn from */
+    int screen_block;
+
+    /* the world tile at the top left of the 32x32 tiles held in the block */
+    int tile_x, tile_y;
+
+    /* world columns and rows which came into view and still need copying */
+    int columns[STREAM_MAX_PENDING];
+    int rows[STREAM_MAX_PENDING];
+    int column_count, row_count;
+
+    /* set when the whole block needs copying */
+    int refresh;
+};
+
+/* start streaming a world map with the camera at a pixel position, the
+ * whole screen block is filled right away */
+void stream_init(struct StreamMap* stream, const unsigned short* map, int width, int height,
+        int screen_block, int camera_x, int camera_y);
+
+/* start streaming one layer of a metatile map, metatiles are expanded into
+ * tiles as they come into view */
+void stream_init_metatiles(struct StreamMap* stream, const struct MetatileMap* world, int layer,
+        int screen_block, int camera_x, int camera_y);
+
+/* move the camera to a pixel position, this only works out which columns
+ * and rows come into view, set the background scroll to the same position */
+void stream_scroll(struct StreamMap* stream, int camera_x, int camera_y);
+
+/* copy the columns and rows which came into view into the screen block,
+ * call during vblank - each scroll step costs one 32 tile column or row */
+void stream_commit(struct StreamMap* stream);
+
+#endif
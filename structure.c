@@ -1,5 +1,10 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 typedef struct
 {
@@ -19,7 +24,8 @@ int score_set(Score* x, char* y, int z)
 	}
 	else
 	{
-		strcpy(x -> name, y);
+		/* strncpy zero pads the name so records written to disk are deterministic */
+		strncpy(x -> name, y, sizeof(x -> name));
 		x -> score = z;
 		return 1;
 	}
@@ -46,7 +52,200 @@ int score_compare(Score* x, Score* y)
 	}
 }
 
-int main() {
+/*
+Binary score table format:
+	header - ScoreFileHeader, 24 bytes.
+	body   - count fixed width records laid out exactly like Score in memory.
+Since the body matches the in memory layout, a table is loaded by mapping the
+file and pointing at the first record, no parsing is done.
+*/
+#define SCORE_FILE_MAGIC "SCRT"
+#define SCORE_FILE_VERSION 1
+
+typedef struct
+{
+	char magic[4];
+	unsigned int version;
+	unsigned int record_size;
+	unsigned int reserved;
+	unsigned long long count;
+} ScoreFileHeader;
+
+/* A score table mapped from disk. */
+typedef struct
+{
+	void* base;
+	size_t length;
+	const Score* scores;
+	size_t count;
+} ScoreTable;
+
+/* Writes count scores to a binary table at path, returns 1 on success and 0 on failure. */
+int score_table_save(const char* path, const Score* scores, size_t count)
+{
+	ScoreFileHeader header;
+	FILE* file = fopen(path, "wb");
+
+	if (file == NULL)
+	{
+		return 0;
+	}
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, SCORE_FILE_MAGIC, sizeof(header.magic));
+	header.version = SCORE_FILE_VERSION;
+	header.record_size = sizeof(Score);
+	header.count = count;
+
+	if (fwrite(&header, sizeof(header), 1, file) != 1 ||
+		fwrite(scores, sizeof(Score), count, file) != count)
+	{
+		fclose(file);
+		return 0;
+	}
+	return fclose(file) == 0;
+}
+
+/* Maps a binary table into memory, returns 1 on success and 0 on failure. */
+int score_table_load(ScoreTable* table, const char* path)
+{
+	struct stat info;
+	const ScoreFileHeader* header;
+	int fd = open(path, O_RDONLY);
+
+	memset(table, 0, sizeof(*table));
+	if (fd < 0)
+	{
+		return 0;
+	}
+	if (fstat(fd, &info) != 0 || (size_t) info.st_size < sizeof(ScoreFileHeader))
+	{
+		close(fd);
+		return 0;
+	}
+
+	table -> length = info.st_size;
+	table -> base = mmap(NULL, table -> length, PROT_READ, MAP_PRIVATE, fd, 0);
+	/* the mapping stays valid after the descriptor is closed */
+	close(fd);
+	if (table -> base == MAP_FAILED)
+	{
+		table -> base = NULL;
+		return 0;
+	}
+
+	header = (const ScoreFileHeader*) table -> base;
+	if (memcmp(header -> magic, SCORE_FILE_MAGIC, sizeof(header -> magic)) != 0 ||
+		header -> version != SCORE_FILE_VERSION ||
+		header -> record_size != sizeof(Score) ||
+		header -> count > (table -> length - sizeof(ScoreFileHeader)) / sizeof(Score) ||
+		sizeof(ScoreFileHeader) + header -> count * sizeof(Score) != table -> length)
+	{
+		munmap(table -> base, table -> length);
+		memset(table, 0, sizeof(*table));
+		return 0;
+	}
+
+	table -> scores = (const Score*) ((const char*) table -> base + sizeof(ScoreFileHeader));
+	table -> count = header -> count;
+	/* tables are usually read front to back, let the kernel read ahead */
+	madvise(table -> base, table -> length, MADV_SEQUENTIAL);
+	return 1;
+}
+
+/* Unmaps a table loaded with score_table_load. */
+void score_table_unload(ScoreTable* table)
+{
+	if (table -> base != NULL)
+	{
+		munmap(table -> base, table -> length);
+	}
+	memset(table, 0, sizeof(*table));
+}
+
+/* Size of the text export buffer, big enough that fwrite is called rarely. */
+#define EXPORT_BUFFER_SIZE (1 << 16)
+
+/* Longest line is a 3 letter name, a space, a signed 10 digit score and a newline. */
+#define EXPORT_LINE_MAX 16
+
+/*
+Writes scores as text in the same format as score_print, one record per line.
+Lines are formatted by hand into a buffer which is flushed with fwrite when full.
+Returns 1 on success and 0 on failure.
+*/
+int score_export(FILE* out, const Score* scores, size_t count)
+{
+	static char buffer[EXPORT_BUFFER_SIZE];
+	char digits[10];
+	size_t used = 0;
+	size_t i;
+
+	for (i = 0; i < count; i++)
+	{
+		const Score* x = &scores[i];
+		unsigned int value;
+		int n = 0;
+		int j;
+
+		if (used > EXPORT_BUFFER_SIZE - EXPORT_LINE_MAX)
+		{
+			if (fwrite(buffer, 1, used, out) != used)
+			{
+				return 0;
+			}
+			used = 0;
+		}
+
+		for (j = 0; j < 3 && x -> name[j] != '\0'; j++)
+		{
+			buffer[used++] = x -> name[j];
+		}
+		buffer[used++] = ' ';
+
+		if (x -> score < 0)
+		{
+			buffer[used++] = '-';
+			value = 0u - (unsigned int) x -> score;
+		}
+		else
+		{
+			value = x -> score;
+		}
+		do
+		{
+			digits[n++] = '0' + value % 10;
+			value /= 10;
+		} while (value != 0);
+		while (n > 0)
+		{
+			buffer[used++] = digits[--n];
+		}
+		buffer[used++] = '\n';
+	}
+
+	return fwrite(buffer, 1, used, out) == used;
+}
+
+/*
+Usage:
+	structure           - sort and print the test data.
+	structure -w FILE   - sort the test data and save it as a binary table.
+	structure FILE      - print a binary table.
+*/
+int main(int argc, char** argv) {
+    ScoreTable table;
+
+    if (argc == 2) {
+        if (!score_table_load(&table, argv[1])) {
+            fprintf(stderr, "could not load score table %s\n", argv[1]);
+            return 1;
+        }
+        int ok = score_export(stdout, table.scores, table.count);
+        score_table_unload(&table);
+        return ok ? 0 : 1;
+    }
+
     /* create an array of scores */
     Score scores[10];
 
@@ -66,11 +265,14 @@ int main() {
     qsort(scores, 10, sizeof(Score), 
         (int (*) (const void*, const void*)) &score_compare);
 
-    /* display them */
-    int i;
-    for (i = 0; i < 10; i++) {
-        score_print(&scores[i]);
+    if (argc == 3 && strcmp(argv[1], "-w") == 0) {
+        if (!score_table_save(argv[2], scores, 10)) {
+            fprintf(stderr, "could not save score table %s\n", argv[2]);
+            return 1;
+        }
+        return 0;
     }
 
-    return 0;
+    /* display them */
+    return score_export(stdout, scores, 10) ? 0 : 1;
 }
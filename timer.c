@@ -0,0 +1,98 @@
+/*
+ * timer.c
+ * the four gba hardware timers, a running tick clock and frame pacing
+ */
+
+#include "gba.h"
+#include "interrupt.h"
+#include "timer.h"
+
+/* the timers used for the clock and for sleeping */
+#define CLOCK_LOW 2
+#define CLOCK_HIGH 3
+#define SLEEP_TIMER 1
+
+/* set by the sleep timer's interrupt when the sleep is over */
+static volatile int sleep_done;
+
+/* the vblank frame_wait last returned on */
+static unsigned int last_frame;
+
+void timer_init() {
+    /* the low half counts at 1024 cycles, the high half counts each time
+     * the low half wraps */
+    timer_start(CLOCK_HIGH, 0, TIMER_CASCADE);
+    timer_start(CLOCK_LOW, 0, TIMER_FREQ_1024);
+    last_frame = vblank_count;
+}
+
+unsigned int timer_ticks() {
+    unsigned short high, low;
+
+    /* read the high half again if the low half wrapped in between */
+    do {
+        high = timer_read(CLOCK_HIGH);
+        low = timer_read(CLOCK_LOW);
+    } while (high != timer_read(CLOCK_HIGH));
+
+    return ((unsigned int) high << 16) | low;
+}
+
+void timer_start(int timer, unsigned short reload, unsigned short flags) {
+    volatile unsigned short* registers = timer_registers(timer);
+
+    /* the reload value is copied into the count when the timer is enabled */
+    registers[1] = 0;
+    registers[0] = reload;
+    registers[1] = flags | TIMER_ENABLE;
+}
+
+void timer_stop(int timer) {
+    timer_registers(timer)[1] = 0;
+}
+
+unsigned short timer_read(int timer) {
+    return timer_registers(timer)[0];
+}
+
+void timer_set_callback(int timer, intrp callback) {
+    interrupt_set_handler(INTERRUPT_TIMER0 + timer, callback);
+    if (callback) {
+        interrupt_enable(INTERRUPT_TIMER0 + timer);
+    } else {
+        interrupt_disable(INTERRUPT_TIMER0 + timer);
+    }
+}
+
+/* the sleep timer only needs to go off once */
+static void sleep_over() {
+    timer_stop(SLEEP_TIMER);
+    sleep_done = 1;
+}
+
+void sleep_ticks(unsigned int ticks) {
+    timer_set_callback(SLEEP_TIMER, sleep_over);
+
+    /* the timer is 16 bits so long sleeps are done in pieces */
+    while (ticks > 0) {
+        unsigned int amount = ticks > 0xffff ? 0xffff : ticks;
+
+        sleep_done = 0;
+        timer_start(SLEEP_TIMER, 0x10000 - amount, TIMER_FREQ_1024 | TIMER_IRQ);
+        while (!sleep_done) {
+            interrupt_wait(1 << (INTERRUPT_TIMER0 + SLEEP_TIMER));
+        }
+        ticks -= amount;
+    }
+
+    timer_set_callback(SLEEP_TIMER, 0);
+}
+
+void frame_wait(unsigned int frames) {
+    /* always wait for at least one vblank, so the caller is in vblank when
+     * this returns, even when the frame ran long and the target has passed */
+    do {
+        wait_vblank();
+    } while (vblank_count - last_frame < frames);
+    last_frame = vblank_count;
+}
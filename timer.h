@@ -0,0 +1,64 @@
+/*
+ * timer.h
+ * the four gba hardware timers, a running tick clock and frame pacing
+ *
+ * timers 2 and 3 are cascaded into a 32-bit clock counting TIMER_HZ ticks
+ * a second, timer 1 is used by sleep_ticks, and timer 0 is left free for
+ * programs to use with timer_start
+ */
+
+#ifndef TIMER_H
+#define TIMER_H
+
+#include "interrupt.h"
+
+/* how many cpu cycles each timer count takes */
+#define TIMER_FREQ_1 0x0
+#define TIMER_FREQ_64 0x1
+#define TIMER_FREQ_256 0x2
+#define TIMER_FREQ_1024 0x3
+
+/* count once each time the timer below overflows instead of on the clock */
+#define TIMER_CASCADE 0x4
+
+/* raise the timer's interrupt each time it overflows */
+#define TIMER_IRQ 0x40
+
+/* turn the timer on */
+#define TIMER_ENABLE 0x80
+
+/* the clock runs at 16.78MHz / 1024 */
+#define TIMER_HZ 16384
+
+/* turn sleep lengths in milliseconds into clock ticks */
+#define MS_TO_TICKS(ms) (((ms) * TIMER_HZ) / 1000)
+
+/* start the tick clock, call this after interrupt_init */
+void timer_init();
+
+/* the number of ticks since timer_init */
+unsigned int timer_ticks();
+
+/* start a timer (0-3) counting up from reload, flags holds the frequency,
+ * TIMER_CASCADE and TIMER_IRQ */
+void timer_start(int timer, unsigned short reload, unsigned short flags);
+
+/* stop a timer */
+void timer_stop(int timer);
+
+/* read a timer's current count */
+unsigned short timer_read(int timer);
+
+/* call a function from a timer's interrupt, 0 removes it, the timer must be
+ * started with TIMER_IRQ */
+void timer_set_callback(int timer, intrp callback);
+
+/* halt the cpu for a number of ticks */
+void sleep_ticks(unsigned int ticks);
+
+/* halt the cpu until frames vblanks have passed since the last call, so a
+ * game loop ending in frame_wait(n) runs exactly every n frames, it always
+ * returns at the start of a vblank, even after a frame which ran long */
+void frame_wait(unsigned int frames);
+
+#endif
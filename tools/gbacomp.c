@@ -0,0 +1,280 @@
+/*
+ * gbacomp.c
+ * Compresses one byte array of a generated header, such as the _data array
+ * written by png2gba, into the format the GBA BIOS decompression calls take
+ * (see decompress.h). The rest of the header is copied through unchanged,
+ * so the output is a drop in replacement with the same names.
+ *
+ * usage: gbacomp lz77|rle|auto ARRAY INPUT.h > OUTPUT.h
+ *
+ * auto keeps whichever of the two is smaller.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TYPE_LZ77 0x10
+#define TYPE_RLE 0x30
+
+/* LZ77 copies 3 to 18 bytes from up to 4096 bytes back. The VRAM version of
+ * the BIOS call writes 16 bits at a time, so a copy can not start at the
+ * byte just before, it has not been written yet. */
+#define LZ_MIN 3
+#define LZ_MAX 18
+#define LZ_WINDOW 4096
+#define LZ_MIN_DISTANCE 2
+
+/* Runs of 3 to 130 bytes, or 1 to 128 bytes copied as they are. */
+#define RLE_MIN 3
+#define RLE_MAX 130
+#define RLE_LITERAL_MAX 128
+
+typedef struct
+{
+	unsigned char* bytes;
+	size_t size, capacity;
+} Buffer;
+
+void buffer_put(Buffer* buffer, unsigned char byte)
+{
+	if (buffer->size == buffer->capacity)
+	{
+		buffer->capacity = buffer->capacity ? buffer->capacity * 2 : 1024;
+		buffer->bytes = realloc(buffer->bytes, buffer->capacity);
+	}
+	buffer->bytes[buffer->size++] = byte;
+}
+
+/* The header both formats start with, the size and type. */
+void put_header(Buffer* out, int type, size_t size)
+{
+	buffer_put(out, type);
+	buffer_put(out, size & 0xff);
+	buffer_put(out, (size >> 8) & 0xff);
+	buffer_put(out, (size >> 16) & 0xff);
+}
+
+/* The BIOS reads whole words, so the output is padded to a multiple of 4. */
+void pad(Buffer* out)
+{
+	while (out->size % 4)
+	{
+		buffer_put(out, 0);
+	}
+}
+
+/* Greedy LZ77, each block is the longest match in the window or a literal. */
+Buffer compress_lz77(const unsigned char* data, size_t size)
+{
+	Buffer out = {0};
+	put_header(&out, TYPE_LZ77, size);
+
+	size_t pos = 0;
+	while (pos < size)
+	{
+		/* A flag byte, high bit first, says which of the next 8 blocks are copies. */
+		size_t flag_index = out.size;
+		buffer_put(&out, 0);
+		for (int block = 0; block < 8 && pos < size; block++)
+		{
+			size_t best_length = 0, best_distance = 0;
+			for (size_t distance = LZ_MIN_DISTANCE; distance <= LZ_WINDOW && distance <= pos; distance++)
+			{
+				size_t length = 0;
+				while (length < LZ_MAX && pos + length < size && data[pos + length] == data[pos + length - distance])
+				{
+					length++;
+				}
+				if (length > best_length)
+				{
+					best_length = length;
+					best_distance = distance;
+					if (length == LZ_MAX) break;
+				}
+			}
+
+			if (best_length >= LZ_MIN)
+			{
+				out.bytes[flag_index] |= 0x80 >> block;
+				buffer_put(&out, ((best_length - LZ_MIN) << 4) | ((best_distance - 1) >> 8));
+				buffer_put(&out, (best_distance - 1) & 0xff);
+				pos += best_length;
+			}
+			else
+			{
+				buffer_put(&out, data[pos++]);
+			}
+		}
+	}
+	pad(&out);
+	return out;
+}
+
+/* Run length, runs of 3 or more become a run block, anything else a literal block. */
+Buffer compress_rle(const unsigned char* data, size_t size)
+{
+	Buffer out = {0};
+	put_header(&out, TYPE_RLE, size);
+
+	size_t pos = 0, literal_start = 0;
+	while (pos <= size)
+	{
+		size_t run = 0;
+		while (pos < size && pos + run < size && run < RLE_MAX && data[pos + run] == data[pos])
+		{
+			run++;
+		}
+
+		/* Flush the literals before a run, at the end, or when the block is full. */
+		if (run >= RLE_MIN || pos == size || pos - literal_start == RLE_LITERAL_MAX)
+		{
+			while (literal_start < pos)
+			{
+				size_t count = pos - literal_start;
+				if (count > RLE_LITERAL_MAX) count = RLE_LITERAL_MAX;
+				buffer_put(&out, count - 1);
+				for (size_t i = 0; i < count; i++)
+				{
+					buffer_put(&out, data[literal_start++]);
+				}
+			}
+		}
+		if (pos == size)
+		{
+			break;
+		}
+
+		if (run >= RLE_MIN)
+		{
+			buffer_put(&out, 0x80 | (run - RLE_MIN));
+			buffer_put(&out, data[pos]);
+			pos += run;
+			literal_start = pos;
+		}
+		else
+		{
+			pos++;
+		}
+	}
+	pad(&out);
+	return out;
+}
+
+/* Reads a whole file into a zero terminated buffer. */
+char* read_file(const char* path)
+{
+	FILE* file = fopen(path, "rb");
+	if (file == NULL)
+	{
+		perror(path);
+		return NULL;
+	}
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	char* text = malloc(size + 1);
+	if (text == NULL || fread(text, 1, size, file) != (size_t) size)
+	{
+		fprintf(stderr, "%s: could not read\n", path);
+		free(text);
+		fclose(file);
+		return NULL;
+	}
+	text[size] = '\0';
+	fclose(file);
+	return text;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc != 4 || (strcmp(argv[1], "lz77") && strcmp(argv[1], "rle") && strcmp(argv[1], "auto")))
+	{
+		fprintf(stderr, "usage: %s lz77|rle|auto ARRAY INPUT.h\n", argv[0]);
+		return 1;
+	}
+	const char* method = argv[1];
+	const char* array = argv[2];
+	char* text = read_file(argv[3]);
+	if (text == NULL)
+	{
+		return 1;
+	}
+
+	/* Find "const unsigned char ARRAY [] = {" and the "};" closing it. */
+	char declaration[256];
+	snprintf(declaration, sizeof(declaration), "const unsigned char %s [] = {", array);
+	char* start = strstr(text, declaration);
+	if (start == NULL)
+	{
+		snprintf(declaration, sizeof(declaration), "const unsigned char %s[] = {", array);
+		start = strstr(text, declaration);
+	}
+	char* end = start ? strstr(start, "};") : NULL;
+	if (start == NULL || end == NULL)
+	{
+		fprintf(stderr, "%s: no unsigned char array named %s\n", argv[3], array);
+		return 1;
+	}
+
+	Buffer data = {0};
+	char* next = start + strlen(declaration);
+	while (next < end)
+	{
+		char* after;
+		long value = strtol(next, &after, 0);
+		if (after == next)
+		{
+			next++;
+			continue;
+		}
+		buffer_put(&data, (unsigned char) value);
+		next = after;
+	}
+
+	Buffer out;
+	if (strcmp(method, "lz77") == 0)
+	{
+		out = compress_lz77(data.bytes, data.size);
+	}
+	else if (strcmp(method, "rle") == 0)
+	{
+		out = compress_rle(data.bytes, data.size);
+	}
+	else
+	{
+		Buffer lz77 = compress_lz77(data.bytes, data.size);
+		Buffer rle = compress_rle(data.bytes, data.size);
+		if (rle.size < lz77.size)
+		{
+			out = rle;
+			free(lz77.bytes);
+		}
+		else
+		{
+			out = lz77;
+			free(rle.bytes);
+		}
+	}
+
+	/* Everything before the array, the array as words so it is 4 byte aligned, then the rest. */
+	fwrite(text, 1, start - text, stdout);
+	printf("/* %s compressed by gbacomp, %zu bytes down to %zu */\n",
+		out.bytes[0] == TYPE_RLE ? "run length" : "LZ77", data.size, out.size);
+	printf("const unsigned int %s [] = {", array);
+	for (size_t i = 0; i < out.size; i += 4)
+	{
+		unsigned int word = out.bytes[i] | (out.bytes[i + 1] << 8) | (out.bytes[i + 2] << 16) | ((unsigned int) out.bytes[i + 3] << 24);
+		printf("%s0x%08x,", (i % 24 == 0) ? "\n    " : " ", word);
+	}
+	printf("\n");
+	fputs(end, stdout);
+
+	fprintf(stderr, "%s: %s, %zu bytes down to %zu\n", array,
+		out.bytes[0] == TYPE_RLE ? "run length" : "LZ77", data.size, out.size);
+	free(out.bytes);
+	free(data.bytes);
+	free(text);
+	return 0;
+}
@@ -0,0 +1,315 @@
+/*
+ * metagen.c
+ * Builds a metatile header (see metatile.h) from a visible tile map header
+ * and a boundary tile map header, as written by the GBA Tile Editor.
+ *
+ * usage: metagen [-r PACKED.h] NAME VISIBLE.h BOUNDARY.h WARP INTERACT BLOCK > NAME.h
+ *
+ * WARP, INTERACT and BLOCK are the boundary tile ids which mark each kind of
+ * tile, anything else is walkable. The collision kinds are worked out here,
+ * so the game never looks at boundary ids.
+ *
+ * With -r the tile entries are passed through the _remap table of an image
+ * packed by tilegen. Collision still goes by the original boundary ids, so
+ * a marker tile merged with a look alike keeps its meaning.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define METATILE_SIZE 2
+#define METATILE_MAX 256
+
+/* Tile map entry bits. */
+#define ENTRY_TILE 0x03ff
+#define ENTRY_FLIPS 0x0c00
+
+/* Collision kinds, these match the TILE_ values of the game. */
+#define TILE_WALK 0
+#define TILE_BLOCK 1
+#define TILE_INTERACT 2
+#define TILE_WARP 3
+
+typedef struct
+{
+	unsigned short* tiles;
+	int width, height;
+} TileMap;
+
+typedef struct
+{
+	unsigned short visible[4];
+	unsigned short boundary[4];
+	unsigned char collision;
+} Metatile;
+
+/* Reads a whole file into a zero terminated buffer. */
+char* read_file(const char* path)
+{
+	FILE* file = fopen(path, "rb");
+	if (file == NULL)
+	{
+		perror(path);
+		return NULL;
+	}
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	char* text = malloc(size + 1);
+	if (text == NULL || fread(text, 1, size, file) != (size_t) size)
+	{
+		fprintf(stderr, "%s: could not read\n", path);
+		free(text);
+		fclose(file);
+		return NULL;
+	}
+	text[size] = '\0';
+	fclose(file);
+	return text;
+}
+
+/* Finds the value of the first "#define ..._SUFFIX N" line. */
+int read_define(const char* text, const char* suffix)
+{
+	const char* line = text;
+	while ((line = strstr(line, "#define")) != NULL)
+	{
+		char name[128];
+		int value;
+		if (sscanf(line, "#define %127s %i", name, &value) == 2)
+		{
+			size_t length = strlen(name);
+			size_t suffix_length = strlen(suffix);
+			if (length > suffix_length && strcmp(name + length - suffix_length, suffix) == 0)
+			{
+				return value;
+			}
+		}
+		line += 7;
+	}
+	return -1;
+}
+
+/* Loads a tile map header, the numbers between the braces are the entries. */
+int load_map(const char* path, TileMap* map)
+{
+	char* text = read_file(path);
+	if (text == NULL)
+	{
+		return 0;
+	}
+
+	map->width = read_define(text, "_width");
+	map->height = read_define(text, "_height");
+	char* values = strchr(text, '{');
+	if (map->width <= 0 || map->height <= 0 || values == NULL)
+	{
+		fprintf(stderr, "%s: not a tile map header\n", path);
+		free(text);
+		return 0;
+	}
+
+	int count = map->width * map->height;
+	map->tiles = calloc(count, sizeof(unsigned short));
+	char* next = values + 1;
+	for (int i = 0; i < count; i++)
+	{
+		char* end;
+		long value = strtol(next, &end, 0);
+		if (end == next)
+		{
+			fprintf(stderr, "%s: expected %d entries, found %d\n", path, count, i);
+			free(text);
+			return 0;
+		}
+		map->tiles[i] = (unsigned short) value;
+		next = end;
+		while (*next == ',' || *next == ' ' || *next == '\n' || *next == '\r' || *next == '\t')
+		{
+			next++;
+		}
+	}
+	free(text);
+	return 1;
+}
+
+/* Loads the _remap table of a tilegen header, the new entry of every original tile. */
+int load_remap(const char* path, TileMap* remap)
+{
+	char* text = read_file(path);
+	if (text == NULL)
+	{
+		return 0;
+	}
+	char* values = strstr(text, "_remap [] = {");
+	if (values == NULL)
+	{
+		fprintf(stderr, "%s: no _remap table\n", path);
+		free(text);
+		return 0;
+	}
+
+	remap->width = 0;
+	remap->height = 1;
+	remap->tiles = calloc(ENTRY_TILE + 1, sizeof(unsigned short));
+	char* next = strchr(values, '{') + 1;
+	while (*next != '}' && remap->width <= ENTRY_TILE)
+	{
+		char* end;
+		long value = strtol(next, &end, 0);
+		if (end == next)
+		{
+			next++;
+			continue;
+		}
+		remap->tiles[remap->width++] = (unsigned short) value;
+		next = end;
+	}
+	free(text);
+	return 1;
+}
+
+/* Passes an entry through the remap table, flips in the original entry are kept. */
+unsigned short remap_entry(const TileMap* remap, unsigned short entry)
+{
+	if (remap == NULL || (entry & ENTRY_TILE) >= remap->width)
+	{
+		return entry;
+	}
+	return remap->tiles[entry & ENTRY_TILE] ^ (entry & ENTRY_FLIPS);
+}
+
+/* The entry at x, y, past the edge of an odd sized map is tile 0. */
+unsigned short map_entry(const TileMap* map, int x, int y)
+{
+	if (x >= map->width || y >= map->height)
+	{
+		return 0;
+	}
+	return map->tiles[y * map->width + x];
+}
+
+int main(int argc, char** argv)
+{
+	TileMap remap_table;
+	TileMap* remap = NULL;
+	if (argc == 9 && strcmp(argv[1], "-r") == 0)
+	{
+		if (!load_remap(argv[2], &remap_table))
+		{
+			return 1;
+		}
+		remap = &remap_table;
+		argv += 2;
+		argc -= 2;
+	}
+	if (argc != 7)
+	{
+		fprintf(stderr, "usage: metagen [-r PACKED.h] NAME VISIBLE.h BOUNDARY.h WARP INTERACT BLOCK\n");
+		return 1;
+	}
+	const char* name = argv[1];
+	unsigned short warp = (unsigned short) strtol(argv[4], NULL, 0);
+	unsigned short interact = (unsigned short) strtol(argv[5], NULL, 0);
+	unsigned short block = (unsigned short) strtol(argv[6], NULL, 0);
+
+	TileMap visible, boundary;
+	if (!load_map(argv[2], &visible) || !load_map(argv[3], &boundary))
+	{
+		return 1;
+	}
+	if (visible.width != boundary.width || visible.height != boundary.height)
+	{
+		fprintf(stderr, "the visible and boundary maps are different sizes\n");
+		return 1;
+	}
+
+	int width = (visible.width + METATILE_SIZE - 1) / METATILE_SIZE;
+	int height = (visible.height + METATILE_SIZE - 1) / METATILE_SIZE;
+	unsigned char* map = malloc(width * height);
+	Metatile metatiles[METATILE_MAX];
+	int count = 0;
+
+	for (int y = 0; y < height; y++)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			Metatile metatile;
+			memset(&metatile, 0, sizeof(metatile));
+			for (int corner = 0; corner < 4; corner++)
+			{
+				int tile_x = x * METATILE_SIZE + (corner & 1);
+				int tile_y = y * METATILE_SIZE + (corner >> 1);
+				unsigned short id = map_entry(&boundary, tile_x, tile_y);
+				unsigned char kind = TILE_WALK;
+				if (id == warp) kind = TILE_WARP;
+				else if (id == interact) kind = TILE_INTERACT;
+				else if (id == block) kind = TILE_BLOCK;
+
+				metatile.visible[corner] = remap_entry(remap, map_entry(&visible, tile_x, tile_y));
+				metatile.boundary[corner] = remap_entry(remap, id);
+				metatile.collision |= kind << (corner * 2);
+			}
+
+			/* A linear search is plenty for at most 256 metatiles. */
+			int index;
+			for (index = 0; index < count; index++)
+			{
+				if (memcmp(&metatiles[index], &metatile, sizeof(metatile)) == 0)
+				{
+					break;
+				}
+			}
+			if (index == count)
+			{
+				if (count == METATILE_MAX)
+				{
+					fprintf(stderr, "more than %d distinct metatiles\n", METATILE_MAX);
+					return 1;
+				}
+				metatiles[count++] = metatile;
+			}
+			map[y * width + x] = (unsigned char) index;
+		}
+	}
+
+	printf("/* created by metagen from %s and %s */\n\n", argv[2], argv[3]);
+	printf("#define %s_width %d\n", name, width);
+	printf("#define %s_height %d\n", name, height);
+	printf("#define %s_count %d\n\n", name, count);
+
+	printf("const struct Metatile %s_metatiles [] = {\n", name);
+	for (int i = 0; i < count; i++)
+	{
+		Metatile* m = &metatiles[i];
+		printf("    {{{0x%04x, 0x%04x, 0x%04x, 0x%04x}, {0x%04x, 0x%04x, 0x%04x, 0x%04x}}},\n",
+			m->visible[0], m->visible[1], m->visible[2], m->visible[3],
+			m->boundary[0], m->boundary[1], m->boundary[2], m->boundary[3]);
+	}
+	printf("};\n\n");
+
+	printf("const unsigned char %s_collision [] = {", name);
+	for (int i = 0; i < count; i++)
+	{
+		printf("%s0x%02x,", (i % 12 == 0) ? "\n    " : " ", metatiles[i].collision);
+	}
+	printf("\n};\n\n");
+
+	printf("const unsigned char %s_map [] = {", name);
+	for (int i = 0; i < width * height; i++)
+	{
+		printf("%s%3d,", (i % width == 0) ? "\n    " : " ", map[i]);
+	}
+	printf("\n};\n\n");
+
+	printf("const struct MetatileMap %s = {%s_metatiles, %s_collision, %s_map, %d, %d};\n",
+		name, name, name, name, width, height);
+
+	fprintf(stderr, "%s: %d metatiles, %d bytes instead of %d\n", name, count,
+		count * (int) (sizeof(unsigned short) * 8 + 1) + width * height,
+		visible.width * visible.height * 2 * 2);
+	free(map);
+	return 0;
+}
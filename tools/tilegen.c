@@ -0,0 +1,372 @@
+/*
+ * tilegen.c
+ * Packs the tile image of a png2gba header for a tiled background. Tiles no
+ * map uses are dropped, tiles which repeat, or which are a flipped copy of
+ * another, are stored once, and when every tile fits in 15 colours plus
+ * transparency the image becomes 4bpp with the colours split into palette
+ * banks.
+ *
+ * usage: tilegen IMAGE.h [MAP.h ...] > PACKED.h
+ *
+ * The output is a png2gba style header with the same names, the image is one
+ * tile wide, plus NAME_bpp and NAME_remap. The remap table gives the tile map
+ * entry (tile, flip bits and palette bank) for every tile of the original
+ * image, metagen -r applies it to the maps. With no maps every tile is kept.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TILE_PIXELS 64
+#define MAX_TILES 1024
+#define BANKS 16
+#define BANK_COLORS 16
+
+/* Tile map entry bits. */
+#define ENTRY_TILE 0x03ff
+#define ENTRY_HFLIP 0x0400
+#define ENTRY_VFLIP 0x0800
+#define ENTRY_BANK_SHIFT 12
+
+typedef struct
+{
+	unsigned char pixels[TILE_PIXELS];
+} Tile;
+
+/* Reads a whole file into a zero terminated buffer. */
+char* read_file(const char* path)
+{
+	FILE* file = fopen(path, "rb");
+	if (file == NULL)
+	{
+		perror(path);
+		return NULL;
+	}
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	char* text = malloc(size + 1);
+	if (text == NULL || fread(text, 1, size, file) != (size_t) size)
+	{
+		fprintf(stderr, "%s: could not read\n", path);
+		free(text);
+		fclose(file);
+		return NULL;
+	}
+	text[size] = '\0';
+	fclose(file);
+	return text;
+}
+
+/* Reads the numbers of the array whose name ends in suffix, or the first array for "". */
+int read_array(const char* text, const char* suffix, long* values, int max, char* name)
+{
+	const char* line = text;
+	while ((line = strstr(line, "const ")) != NULL)
+	{
+		const char* open = strchr(line, '{');
+		const char* bracket = strchr(line, '[');
+		if (open == NULL || bracket == NULL || bracket > open)
+		{
+			return -1;
+		}
+		/* The name is the word before the bracket. */
+		const char* end = bracket;
+		while (end > line && end[-1] == ' ') end--;
+		const char* start = end;
+		while (start > line && start[-1] != ' ') start--;
+		size_t length = end - start;
+		size_t suffix_length = strlen(suffix);
+		if (length >= suffix_length && strncmp(end - suffix_length, suffix, suffix_length) == 0)
+		{
+			memcpy(name, start, length);
+			name[length] = '\0';
+			int count = 0;
+			const char* next = open + 1;
+			while (*next && *next != '}' && count < max)
+			{
+				char* after;
+				long value = strtol(next, &after, 0);
+				if (after == next)
+				{
+					next++;
+					continue;
+				}
+				values[count++] = value;
+				next = after;
+			}
+			return count;
+		}
+		line = open;
+	}
+	return -1;
+}
+
+void flip_horizontal(const Tile* in, Tile* out)
+{
+	for (int y = 0; y < 8; y++)
+	{
+		for (int x = 0; x < 8; x++)
+		{
+			out->pixels[y * 8 + x] = in->pixels[y * 8 + 7 - x];
+		}
+	}
+}
+
+void flip_vertical(const Tile* in, Tile* out)
+{
+	for (int y = 0; y < 8; y++)
+	{
+		memcpy(&out->pixels[y * 8], &in->pixels[(7 - y) * 8], 8);
+	}
+}
+
+/* The colours of a tile other than 0, as a 256 bit set. */
+void tile_colors(const Tile* tile, unsigned char* set)
+{
+	memset(set, 0, 256);
+	for (int i = 0; i < TILE_PIXELS; i++)
+	{
+		if (tile->pixels[i]) set[tile->pixels[i]] = 1;
+	}
+}
+
+static Tile tiles[MAX_TILES];
+static Tile packed[MAX_TILES];
+static int packed_bank[MAX_TILES];
+static unsigned short remap[MAX_TILES];
+static int used[MAX_TILES];
+static long values[MAX_TILES * TILE_PIXELS];
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		fprintf(stderr, "usage: %s IMAGE.h [MAP.h ...]\n", argv[0]);
+		return 1;
+	}
+	char* text = read_file(argv[1]);
+	if (text == NULL)
+	{
+		return 1;
+	}
+
+	char data_name[128], palette_name[128];
+	int size = read_array(text, "_data", values, MAX_TILES * TILE_PIXELS, data_name);
+	if (size <= 0 || size % TILE_PIXELS)
+	{
+		fprintf(stderr, "%s: no 8bpp _data array of whole tiles\n", argv[1]);
+		return 1;
+	}
+	int count = size / TILE_PIXELS;
+	for (int i = 0; i < size; i++)
+	{
+		tiles[i / TILE_PIXELS].pixels[i % TILE_PIXELS] = (unsigned char) values[i];
+	}
+	long palette[256] = {0};
+	if (read_array(text, "_palette", values, 256, palette_name) <= 0)
+	{
+		fprintf(stderr, "%s: no _palette array\n", argv[1]);
+		return 1;
+	}
+	memcpy(palette, values, sizeof(palette));
+
+	/* The image name is the data array without _data. */
+	char name[128];
+	strcpy(name, data_name);
+	name[strlen(name) - strlen("_data")] = '\0';
+
+	/* Keep only the tiles the maps use. */
+	for (int i = 0; i < count; i++)
+	{
+		used[i] = (argc == 2);
+	}
+	for (int m = 2; m < argc; m++)
+	{
+		char* map_text = read_file(argv[m]);
+		char map_name[128];
+		int entries = map_text ? read_array(map_text, "", values, MAX_TILES * TILE_PIXELS, map_name) : -1;
+		if (entries <= 0)
+		{
+			fprintf(stderr, "%s: no tile map\n", argv[m]);
+			return 1;
+		}
+		for (int i = 0; i < entries; i++)
+		{
+			int tile = values[i] & ENTRY_TILE;
+			if (tile < count) used[tile] = 1;
+		}
+		free(map_text);
+	}
+
+	/* Each used tile either matches a packed tile, as it is or flipped, or is added. */
+	int packed_count = 0;
+	for (int i = 0; i < count; i++)
+	{
+		if (!used[i])
+		{
+			remap[i] = 0;
+			continue;
+		}
+		Tile flips[4];
+		flips[0] = tiles[i];
+		flip_horizontal(&tiles[i], &flips[1]);
+		flip_vertical(&tiles[i], &flips[2]);
+		flip_vertical(&flips[1], &flips[3]);
+
+		int match = -1, flip = 0;
+		for (int p = 0; p < packed_count && match < 0; p++)
+		{
+			for (int f = 0; f < 4; f++)
+			{
+				if (memcmp(&packed[p], &flips[f], sizeof(Tile)) == 0)
+				{
+					match = p;
+					flip = f;
+					break;
+				}
+			}
+		}
+		if (match < 0)
+		{
+			match = packed_count;
+			packed[packed_count++] = tiles[i];
+		}
+		/* Flip f of tile i is the packed tile, so drawing it with flip f gives tile i back. */
+		remap[i] = match | ((flip & 1) ? ENTRY_HFLIP : 0) | ((flip & 2) ? ENTRY_VFLIP : 0);
+	}
+
+	/* Try to fit every packed tile's colours into 16 banks of 15 colours, largest tiles first. */
+	unsigned char bank_colors[BANKS][256];
+	int bank_size[BANKS] = {0};
+	int banks = 0, bpp = 4;
+	int order[MAX_TILES], color_count[MAX_TILES];
+	unsigned char set[256];
+	for (int p = 0; p < packed_count; p++)
+	{
+		tile_colors(&packed[p], set);
+		color_count[p] = 0;
+		for (int c = 0; c < 256; c++) color_count[p] += set[c];
+		order[p] = p;
+	}
+	for (int a = 1; a < packed_count; a++)
+	{
+		int p = order[a], b = a;
+		while (b > 0 && color_count[order[b - 1]] < color_count[p])
+		{
+			order[b] = order[b - 1];
+			b--;
+		}
+		order[b] = p;
+	}
+	memset(bank_colors, 0, sizeof(bank_colors));
+	for (int a = 0; a < packed_count && bpp == 4; a++)
+	{
+		int p = order[a];
+		tile_colors(&packed[p], set);
+		int placed = 0;
+		for (int b = 0; b < banks + 1 && b < BANKS && !placed; b++)
+		{
+			int extra = 0;
+			for (int c = 0; c < 256; c++) extra += set[c] && !bank_colors[b][c];
+			if (bank_size[b] + extra <= BANK_COLORS - 1)
+			{
+				for (int c = 0; c < 256; c++) if (set[c]) bank_colors[b][c] = 1;
+				bank_size[b] += extra;
+				packed_bank[p] = b;
+				if (b == banks) banks++;
+				placed = 1;
+			}
+		}
+		if (!placed)
+		{
+			fprintf(stderr, "%s: a tile has more colours than fit a 4bpp bank, keeping 8bpp\n", name);
+			bpp = 8;
+		}
+	}
+
+	/* In 4bpp each bank lists its colours from entry 1 on, entry 0 stays transparent. */
+	long new_palette[256] = {0};
+	/* Colour 0 is transparent in every bank, so it stays 0. */
+	unsigned char local[BANKS][256];
+	memset(local, 0, sizeof(local));
+	if (bpp == 4)
+	{
+		for (int b = 0; b < banks; b++)
+		{
+			int next = 1;
+			new_palette[b * BANK_COLORS] = palette[0];
+			for (int c = 1; c < 256; c++)
+			{
+				if (bank_colors[b][c])
+				{
+					local[b][c] = next;
+					new_palette[b * BANK_COLORS + next++] = palette[c];
+				}
+			}
+		}
+		for (int i = 0; i < count; i++)
+		{
+			if (used[i]) remap[i] |= packed_bank[remap[i] & ENTRY_TILE] << ENTRY_BANK_SHIFT;
+		}
+	}
+	else
+	{
+		memcpy(new_palette, palette, sizeof(palette));
+	}
+
+	printf("/* %s.h\n * packed by tilegen from %s */\n\n", name, argv[1]);
+	printf("#define %s_width 8\n", name);
+	printf("#define %s_height %d\n", name, packed_count * 8);
+	printf("#define %s_bpp %d\n\n", name, bpp);
+
+	printf("const unsigned char %s [] = {\n", data_name);
+	int bytes = 0;
+	for (int p = 0; p < packed_count; p++)
+	{
+		for (int i = 0; i < TILE_PIXELS; i += (bpp == 4) ? 2 : 1)
+		{
+			int value;
+			if (bpp == 4)
+			{
+				/* The left pixel is the low nibble. */
+				int bank = packed_bank[p];
+				value = local[bank][packed[p].pixels[i]] | (local[bank][packed[p].pixels[i + 1]] << 4);
+			}
+			else
+			{
+				value = packed[p].pixels[i];
+			}
+			printf("%s0x%02x,", (bytes % 12 == 0) ? "    " : " ", value);
+			if (++bytes % 12 == 0) printf("\n");
+		}
+	}
+	printf("%s};\n\n", (bytes % 12) ? "\n" : "");
+
+	printf("const unsigned short %s [] = {\n", palette_name);
+	for (int c = 0; c < 256; c++)
+	{
+		printf("%s0x%04lx,", (c % 9 == 0) ? "    " : " ", new_palette[c] & 0xffff);
+		if (c % 9 == 8) printf("\n");
+	}
+	printf("\n};\n\n");
+
+	/* Only the tools read the remap table, so it is left out of the game. */
+	printf("/* The tile map entry of each tile of the original image, for metagen -r. */\n");
+	printf("#ifdef TILEGEN_REMAP\n");
+	printf("const unsigned short %s_remap [] = {\n", name);
+	for (int i = 0; i < count; i++)
+	{
+		printf("%s0x%04x,", (i % 9 == 0) ? "    " : " ", remap[i]);
+		if (i % 9 == 8) printf("\n");
+	}
+	printf("%s};\n", (count % 9) ? "\n" : "");
+	printf("#endif\n");
+
+	fprintf(stderr, "%s: %d tiles down to %d at %dbpp, %d bytes down to %d\n", name, count, packed_count,
+		bpp, count * TILE_PIXELS, packed_count * TILE_PIXELS * bpp / 8);
+	free(text);
+	return 0;
+}